@@ -5,6 +5,7 @@
 
 #include <EGL/egl.h>
 #include <GLES3/gl3.h>
+#include <GLES2/gl2ext.h>
 
 #include <openxr/openxr.h>
 #include <openxr/openxr_platform.h>
@@ -18,22 +19,31 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cerrno>
 #include <chrono>
 #include <cctype>
+#include <condition_variable>
 #include <cmath>
+#include <cstddef>
 #include <cstdlib>
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
+#include <ctime>
 #include <dirent.h>
 #include <fstream>
+#include <functional>
+#include <initializer_list>
+#include <future>
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <sys/system_properties.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <thread>
 #include <unistd.h>
 #include <vector>
 #include <deque>
@@ -54,6 +64,10 @@ constexpr uint32_t kProjectMOutputWidthNative = 2048;
 constexpr uint32_t kProjectMOutputHeightNative = 1024;
 constexpr float kDefaultProjectMRenderScale = 0.58f;
 constexpr float kMinProjectMRenderScale = 0.50f;
+constexpr size_t kGpuPassTimerQueryCount = 4;
+constexpr double kGpuPassTimeSmoothing = 0.1;
+constexpr size_t kGpuPassSampleWindow = 120;
+constexpr double kGpuPassStatsPublishSeconds = 0.5;
 constexpr int kMinProjectMRenderWidth = 512;
 constexpr int kMinProjectMRenderHeight = 256;
 constexpr uint32_t kDefaultPcmFramesPerPush = 512;
@@ -92,9 +106,23 @@ constexpr float kHudTouchForwardOffset = 0.007f;
 constexpr float kHudFlashPeak = 1.35f;
 constexpr double kRuntimePropertyPollIntervalSeconds = 1.0;
 constexpr double kPerfGraceAfterPresetSwitchSeconds = 4.0;
+// projectM renders both presets during a blend. A blend whose predicted GPU time misses the budget becomes a
+// snapshot crossfade (a hard cut in projectM, faded from a copy of the outgoing frame in the scene pass). Without a
+// snapshot it is shortened when the overrun is small enough to sit out briefly, and cut otherwise.
+constexpr double kPresetBlendSeconds = 3.0;
+constexpr double kPresetShortBlendSeconds = 1.0;
+constexpr double kPresetShortBlendMaxOverrun = 1.25;
+// A snapshot crossfade holds on the frozen frame until the incoming preset's first frame, but never longer.
+constexpr double kSnapshotFirstFrameTimeoutSeconds = 5.0;
+constexpr float kPresetGpuCostLearnRate = 0.5f;
 constexpr float kDefaultPerfAutoSkipMinFps = 42.0f;
 constexpr double kDefaultPerfAutoSkipHoldSeconds = 2.0;
 constexpr double kDefaultPerfAutoSkipCooldownSeconds = 8.0;
+constexpr bool kDefaultPerfWatchdogEnabled = true;
+constexpr float kDefaultPerfWatchdogDeadlineMs = 60.0f;
+constexpr float kDefaultPerfWatchdogOverruns = 3.0f;
+// How long the built-in preset plays after a watchdog cut before the next library preset loads.
+constexpr double kWatchdogFallbackSeconds = 3.0;
 constexpr bool kDefaultPerfAutoScaleEnabled = true;
 constexpr float kDefaultPerfAutoScaleMinRenderScale = 0.54f;
 constexpr float kDefaultPerfAutoScaleStep = 0.03f;
@@ -102,16 +130,91 @@ constexpr float kDefaultPerfAutoScaleDownFps = 68.0f;
 constexpr float kDefaultPerfAutoScaleUpFps = 71.0f;
 constexpr double kDefaultPerfAutoScaleHoldSeconds = 1.4;
 constexpr double kDefaultPerfAutoScaleCooldownSeconds = 1.5;
+constexpr bool kDefaultPerfGpuScaleEnabled = true;
+constexpr float kDefaultPerfGpuBudgetFraction = 0.85f;
+constexpr uint32_t kGpuScaleMinSamples = 24;
+// The auto render-target format probe times each candidate over a full GPU sample window; a format other than
+// RGBA8 has to beat it by kFormatProbeMinGain to be picked.
+constexpr float kFormatProbeMinGain = 0.05f;
+constexpr double kFormatProbeCandidateTimeoutSeconds = 20.0;
+constexpr double kGpuScaleSettleSeconds = 1.0;
+constexpr float kGpuScaleMinDeadband = 0.02f;
+constexpr bool kDefaultQualityGovernorEnabled = true;
+// Best-looking rung first: "render_scale/mesh/foveation/refresh_hz".
+constexpr char kDefaultQualityLadder[] =
+    "0.66/64x48/low/90;"
+    "0.58/64x48/medium/90;"
+    "0.58/64x48/medium/72;"
+    "0.54/48x36/high/72;"
+    "0.50/48x36/high/72;"
+    "0.50/32x24/high/72";
+constexpr size_t kMaxQualityRungs = 12;
+constexpr double kQualityGovernorSettleSeconds = 1.5;
+constexpr double kQualityUpgradeHoldSeconds = 3.0;
+constexpr float kQualityCostLearnRate = 0.3f;
+constexpr float kQualityMinUpgradeMargin = 0.05f;
+constexpr float kQualityMaxUpgradeMargin = 0.25f;
+constexpr bool kDefaultPerfAutoFoveationEnabled = true;
+constexpr bool kDefaultPerfAutoEyeScaleEnabled = true;
+constexpr float kDefaultEyeBufferMaxScale = 1.0f;
+constexpr float kMaxEyeBufferAllocationScale = 1.25f;
+constexpr float kDefaultEyeBufferMinScale = 0.80f;
+constexpr float kMinEyeBufferScale = 0.50f;
+constexpr float kEyeBufferScaleStep = 0.05f;
+constexpr int32_t kMinEyeBufferDimension = 256;
+// FPS thresholds are configured against a 72 Hz display and rescaled to the active refresh rate.
+constexpr float kReferenceDisplayRefreshRate = 72.0f;
+constexpr float kMinAutoDisplayRefreshRate = 72.0f;
+constexpr bool kDefaultPerfAutoRefreshRateEnabled = true;
+constexpr double kRefreshRateRaiseHoldSeconds = 20.0;
+constexpr double kPerfBoostAfterPresetSwitchSeconds = 2.0;
+constexpr double kPerfBoostAfterRenderReconfigSeconds = 1.0;
+// projectm_set_window_size rebuilds projectM's internal targets and restarts its feedback, so adaptive viewport
+// steps reach projectM at most once per interval, and growth only after the request has held steady.
+constexpr double kProjectMResizeMinIntervalSeconds = 1.0;
+constexpr double kProjectMResizeGrowHoldSeconds = 3.0;
+constexpr double kPerfBoostStartupSeconds = 6.0;
+constexpr double kSpaceWarpExitHoldSeconds = 30.0;
+// projectM can run at a fraction of the display rate; eye passes blend the last two projectM frames in between.
+constexpr std::array<float, 3> kProjectMCadenceRatios = {1.0f, 2.0f / 3.0f, 0.5f};
+constexpr std::array<const char*, 3> kProjectMCadenceLabels = {"1/1", "2/3", "1/2"};
+constexpr bool kDefaultPerfAutoCadenceEnabled = true;
+constexpr double kCadenceRaiseHoldSeconds = 10.0;
+// projectM renders on its own shared EGL context and publishes into a small ring of output targets.
+constexpr bool kDefaultProjectMAsyncRenderEnabled = true;
+constexpr size_t kProjectMOutputSlotCount = 3;
+constexpr int kNoProjectMOutputSlot = -1;
+constexpr size_t kMaxPendingProjectMPcmFrames = 8192;
+constexpr float kProjectMStalenessSmoothing = 0.1f;
 constexpr double kDefaultPerfSlowRetryCooldownSeconds = 180.0;
 constexpr double kDefaultPerfSlowRetryProbeIntervalSeconds = 45.0;
 constexpr double kDefaultPerfSlowRetryWarmupSeconds = 10.0;
 constexpr double kDefaultPerfRepeatSlowSkipHoldScale = 0.60;
 constexpr double kDefaultPerfRepeatSlowSkipMinHoldSeconds = 0.8;
 constexpr double kRenderStatsLogIntervalSeconds = 5.0;
+// Frame capture: readbacks are mapped this many display frames after they are issued, so the copy has long
+// finished and mapping never stalls.
+constexpr size_t kCaptureRingSize = 6;
+constexpr uint64_t kCaptureReadbackDelayFrames = 3;
+constexpr double kDefaultCaptureIntervalSeconds = 1.0;
+constexpr float kDefaultCaptureMaxFrames = 300.0f;
+// Fraction of display frames projectM still renders while the idle throttle is reducing (unfocused session).
+constexpr float kDefaultIdleThrottleRate = 0.25f;
 constexpr int kDefaultMeshWidth = 64;
 constexpr int kDefaultMeshHeight = 48;
+// Mesh sizes the per-preset mesh governor steps down to, below the rung's (or perf.mesh) size. None exceeds the
+// default mesh, so the governor never raises per-vertex CPU cost above it.
+constexpr std::array<std::pair<int, int>, 3> kProjectMMeshSizes = {{{32, 24}, {48, 36}, {64, 48}}};
+constexpr bool kDefaultPerfAutoMeshEnabled = true;
+constexpr float kDefaultPerfMeshCpuBudgetFraction = 0.6f;
+constexpr double kMeshSettleSeconds = 1.5;
+constexpr double kMeshUpgradeHoldSeconds = 3.0;
+constexpr float kMeshUpgradeMargin = 0.15f;
 constexpr int kHudTextTextureWidth = 1024;
 constexpr int kHudTextTextureHeight = 512;
+// Unpack buffers the HUD text thread writes into; each holds a full texture so any pass fits in one.
+constexpr size_t kHudTextPboCount = 3;
+constexpr size_t kHudTextPboBytes = static_cast<size_t>(kHudTextTextureWidth) * kHudTextTextureHeight;
 constexpr int kHudGlyphWidth = 5;
 constexpr int kHudGlyphHeight = 7;
 constexpr int kHudStatusScale = 2;
@@ -140,6 +243,112 @@ constexpr HudRect kHudRectPresetLock{0.54f, 0.93f, 0.535f, 0.585f};
 constexpr HudRect kHudRectPack{0.07f, 0.33f, 0.08f, 0.24f};
 constexpr HudRect kHudRectCenter{0.37f, 0.63f, 0.08f, 0.24f};
 constexpr HudRect kHudRectProjection{0.67f, 0.93f, 0.08f, 0.24f};
+constexpr int kHudChromeTextureWidth = 1024;
+constexpr int kHudChromeTextureHeight = 512;
+constexpr float kHudPanelColor[3] = {0.08f, 0.08f, 0.10f};
+
+// Static button chrome baked into hudChromeTexture_. Order matches the flash uniforms in RenderHud.
+struct HudChromeButton {
+    HudRect rect;
+    float r;
+    float g;
+    float b;
+    float baseAlpha;
+};
+
+constexpr std::array<HudChromeButton, 7> kHudChromeButtons{{
+    {kHudRectPrevPreset, 0.14f, 0.44f, 0.87f, 0.90f},
+    {kHudRectNextPreset, 0.93f, 0.34f, 0.26f, 0.90f},
+    {kHudRectTogglePlay, 0.18f, 0.74f, 0.38f, 0.90f},
+    {kHudRectNextTrack, 0.91f, 0.82f, 0.28f, 0.90f},
+    {kHudRectPack, 0.58f, 0.32f, 0.86f, 0.88f},
+    {kHudRectCenter, 0.90f, 0.54f, 0.20f, 0.88f},
+    {kHudRectProjection, 0.23f, 0.72f, 0.85f, 0.88f},
+}};
+
+enum class HudTextLabel : uint8_t {
+    Audio = 0,
+    Projection,
+    Playback,
+    Preset,
+    RenderStats,
+    PrevPreset,
+    NextPreset,
+    TogglePlay,
+    NextTrack,
+    Favorite,
+    PresetLock,
+    InputFeedback,
+    BottomLeft,
+    BottomCenter,
+    BottomRight,
+    Count,
+};
+
+struct HudTextLabelLayout {
+    HudRect rect;
+    int scale;
+    uint8_t alpha;
+};
+
+constexpr size_t kHudTextLabelCount = static_cast<size_t>(HudTextLabel::Count);
+
+// Indexed by HudTextLabel. Each label is centered in its rect and re-rasterized only when its string changes.
+constexpr std::array<HudTextLabelLayout, kHudTextLabelCount> kHudTextLabelLayouts{{
+    {{0.05f, 0.34f, 0.885f, 0.93f}, kHudStatusScale, 255},
+    {{0.36f, 0.64f, 0.885f, 0.93f}, kHudStatusScale, 255},
+    {{0.66f, 0.95f, 0.885f, 0.93f}, kHudStatusScale, 255},
+    {{0.05f, 0.95f, 0.835f, 0.875f}, kHudDetailScale, 255},
+    {{0.05f, 0.95f, 0.785f, 0.825f}, kHudDetailScale, 210},
+    {kHudRectPrevPreset, kHudActionScale, 255},
+    {kHudRectNextPreset, kHudActionScale, 255},
+    {kHudRectTogglePlay, kHudActionScale, 255},
+    {kHudRectNextTrack, kHudActionScale, 255},
+    {kHudRectFavorite, kHudInputScale, 170},
+    {kHudRectPresetLock, kHudInputScale, 170},
+    {{0.07f, 0.93f, 0.245f, 0.295f}, kHudInputScale, 190},
+    {kHudRectPack, kHudTriggerScale, 255},
+    {kHudRectCenter, kHudTriggerScale, 255},
+    {kHudRectProjection, kHudTriggerScale, 255},
+}};
+
+// Pixel rectangle in the HUD text texture, top-down rows.
+struct HudPixelRect {
+    int x{0};
+    int y{0};
+    int width{0};
+    int height{0};
+};
+
+struct HudTextLabelState {
+    std::string source;
+    std::string text;
+    HudPixelRect bounds;
+    bool drawn{false};
+};
+
+// Dirty rectangles from the HUD text thread plus their pixels, packed back to back in upload order.
+struct HudTextUpload {
+    std::vector<HudPixelRect> rects;
+    std::vector<uint8_t> pixels;
+};
+
+// Free and Uploading buffers belong to the render thread. A Mapped buffer is handed to the HUD text thread,
+// which writes its pixels and hands it back as Filled; the render thread then unmaps and uploads it.
+enum class HudTextPboState : uint8_t {
+    Free = 0,
+    Mapped = 1,
+    Filled = 2,
+    Uploading = 3,
+};
+
+struct HudTextPbo {
+    GLuint buffer{0};
+    HudTextPboState state{HudTextPboState::Free};
+    uint8_t* mapped{nullptr};
+    std::vector<HudPixelRect> rects;
+    GLsync fence{nullptr};
+};
 
 enum class HandSide : uint8_t {
     Left = 0,
@@ -215,6 +424,9 @@ constexpr std::array<XrHandJointEXT, 2> kHandHighlightJoints{
     XR_HAND_JOINT_THUMB_TIP_EXT,
 };
 
+constexpr uint32_t kProgramBinaryMagic = 0x50424331u;  // "PBC1"
+constexpr uint32_t kMaxProgramBinaryBytes = 8u * 1024u * 1024u;
+
 constexpr char kFallbackPreset[] =
     "[preset00]\n"
     "fDecay=0.98\n"
@@ -237,6 +449,74 @@ enum class ProjectionMode {
     FrontDome = 1,
 };
 
+// How the projectM canvas wraps onto the sphere. Equirect oversamples the poles; equal-area (Lambert cylindrical)
+// spends rows evenly per solid angle, and Compressed sits halfway between the two.
+enum class CanvasMapping : uint8_t {
+    Equirect = 0,
+    EqualArea = 1,
+    Compressed = 2,
+};
+
+enum class FoveationLevel : uint8_t {
+    Off = 0,
+    Low = 1,
+    Medium = 2,
+    High = 3,
+};
+
+enum class CaptureMode : uint8_t {
+    Off = 0,
+    ProjectM = 1,
+    Eye = 2,
+    Both = 3,
+};
+
+enum class PresetTransitionMode : uint8_t {
+    Auto = 0,
+    Smooth = 1,
+    Cut = 2,
+    Snapshot = 3,
+};
+
+// How far projectM is throttled while nobody is looking at it. Ordered so the stronger throttle compares greater.
+enum class IdleThrottle : uint8_t {
+    Full = 0,
+    Reduced = 1,
+    Frozen = 2,
+};
+
+// Throttled time and the projectM work it avoided, priced at the GPU/CPU cost measured before throttling began.
+struct IdleThrottleSavings {
+    double unfocusedSeconds{0.0};
+    double absentSeconds{0.0};
+    double skippedFrames{0.0};
+    double gpuMs{0.0};
+    double cpuMs{0.0};
+};
+
+enum class SpaceWarpMode {
+    Auto = 0,
+    On = 1,
+    Off = 2,
+};
+
+enum class RenderTargetFormat : uint8_t {
+    Auto = 0,
+    Rgba8 = 1,
+    Rgb565 = 2,
+    Rgb10A2 = 3,
+    R11G11B10F = 4,
+};
+
+struct RenderTargetFormatInfo {
+    GLenum internalFormat;
+    uint32_t bytesPerPixel;
+    const char* label;
+};
+
+constexpr FoveationLevel kDefaultFoveationLevel = FoveationLevel::Medium;
+constexpr FoveationLevel kMaxAutoFoveationLevel = FoveationLevel::High;
+
 struct SphereVertex {
     float x;
     float y;
@@ -247,15 +527,149 @@ struct XrSwapchainBundle {
     XrSwapchain handle{XR_NULL_HANDLE};
     int32_t width{0};
     int32_t height{0};
+    int32_t recommendedWidth{0};
+    int32_t recommendedHeight{0};
     std::vector<XrSwapchainImageOpenGLESKHR> images;
 };
 
+// Last kGpuPassSampleWindow timings of one pass, for the rolling average and percentiles.
+struct PassSampleWindow {
+    std::array<float, kGpuPassSampleWindow> samples{};
+    size_t count{0};
+    size_t next{0};
+};
+
+// Rotating GL_EXT_disjoint_timer_query objects for one render pass; results are read a few frames late so the
+// query never stalls the pipeline.
+struct GpuPassTimer {
+    std::array<GLuint, kGpuPassTimerQueryCount> queries{};
+    std::array<bool, kGpuPassTimerQueryCount> pending{};
+    size_t next{0};
+    bool active{false};
+    double smoothedMs{0.0};
+    PassSampleWindow window;
+    // Queries still in flight when the samples were reset; their results measured the old workload.
+    size_t discardPending{0};
+};
+
+enum class GpuPass : uint8_t {
+    ProjectM = 0,
+    Upscale,
+    Eye,
+    Hud,
+    Hands,
+    Count,
+};
+
+constexpr size_t kGpuPassCount = static_cast<size_t>(GpuPass::Count);
+
+struct GpuPassStats {
+    float avgMs{0.0f};
+    float p50Ms{0.0f};
+    float p95Ms{0.0f};
+    float maxMs{0.0f};
+    float stddevMs{0.0f};
+    uint32_t samples{0};
+    // projectM render pixels the samples were measured at (projectM/upscale passes only).
+    uint32_t renderPixels{0};
+};
+
+// projectM's CPU time per frame on the render thread, and the mesh size it was measured at.
+struct ProjectMCpuStats {
+    GpuPassStats render;
+    int meshWidth{0};
+    int meshHeight{0};
+};
+
+// One lever the FPS ladder moves a step at a time. stepDown trades quality for speed and returns false when the
+// lever couldn't move; describe names the current position for the log.
+struct SteppedPerfLever {
+    const char* downFeedback;
+    const char* downLog;
+    const char* upFeedback;
+    const char* upLog;
+    bool canStepDown;
+    bool canStepUp;
+    // Levers whose effect FPS can't show (display-paced ones) wait this long at high FPS before stepping up.
+    double upHoldSeconds;
+    bool extendHud;
+    std::function<std::string()> describe;
+    std::function<bool()> stepDown;
+    std::function<void()> stepUp;
+};
+
+// One rung of the quality governor's ladder. refreshHz 0 keeps the runtime's default rate.
+struct QualityRung {
+    float renderScale{kDefaultProjectMRenderScale};
+    int meshWidth{kDefaultMeshWidth};
+    int meshHeight{kDefaultMeshHeight};
+    FoveationLevel foveation{FoveationLevel::Medium};
+    float refreshHz{0.0f};
+    // Relative GPU cost of the projectM+upscale passes and of the eye passes. Seeded from pixel counts and
+    // foveation, then learned from the times measured after each rung change.
+    float projectMCost{1.0f};
+    float eyeCost{1.0f};
+};
+
+struct ProjectMOutputSlot {
+    GLuint texture{0};
+    GLuint framebuffer{0};
+    GLsync fence{nullptr};
+    uint64_t frameId{0};
+    // Which preset load the frame was rendered after; see LoadProjectMPresetFile.
+    uint64_t presetGeneration{0};
+    double requestedSeconds{0.0};
+};
+
+enum class CaptureSlotState : uint8_t {
+    Free = 0,
+    Issued = 1,   // glReadPixels into the PBO is queued; fence pending.
+    Mapped = 2,   // Mapped for reading; the capture thread owns the pointer.
+    Written = 3,  // The capture thread is done; waiting for the render thread to unmap.
+};
+
+struct CaptureSlot {
+    GLuint pbo{0};
+    size_t capacity{0};
+    GLsync fence{nullptr};
+    CaptureSlotState state{CaptureSlotState::Free};
+    int width{0};
+    int height{0};
+    uint64_t issuedFrame{0};
+    std::string path;
+};
+
+struct CaptureJob {
+    size_t slot{0};
+    const uint8_t* pixels{nullptr};
+    int width{0};
+    int height{0};
+    std::string path;
+};
+
+// A whole-file rewrite for the file write thread.
+struct FileWriteJob {
+    std::string path;
+    std::string contents;
+};
+
 struct HandJointRenderState {
     bool isActive{false};
     std::array<glm::vec3, XR_HAND_JOINT_COUNT_EXT> positions{};
     std::array<uint8_t, XR_HAND_JOINT_COUNT_EXT> tracked{};
 };
 
+struct HandOverlayVertex {
+    glm::vec3 position;
+    glm::vec4 color;
+    float pointSize;
+};
+
+// Bone lines for both hands, then joint and tip points for both hands. Tips follow the joints so they
+// draw on top within the single point call.
+constexpr size_t kHandOverlayLineCapacity = kHandBones.size() * 2 * 2;
+constexpr size_t kHandOverlayPointCapacity = (XR_HAND_JOINT_COUNT_EXT + kHandHighlightJoints.size()) * 2;
+
 struct HandModeDebounceState {
     bool initialized{false};
     bool rawHandTracking{false};
@@ -528,10 +942,13 @@ uint32_t CompileShader(GLenum type, const char* source) {
     return 0;
 }
 
-uint32_t LinkProgram(uint32_t vertexShader, uint32_t fragmentShader) {
+uint32_t LinkProgram(uint32_t vertexShader, uint32_t fragmentShader, bool retrievableBinary) {
     const GLuint program = glCreateProgram();
     glAttachShader(program, vertexShader);
     glAttachShader(program, fragmentShader);
+    if (retrievableBinary) {
+        glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
     glLinkProgram(program);
 
     GLint success = GL_FALSE;
@@ -550,6 +967,121 @@ uint32_t LinkProgram(uint32_t vertexShader, uint32_t fragmentShader) {
     return 0;
 }
 
+uint32_t CompileAndLinkProgram(const char* vertexSource, const char* fragmentSource, bool retrievableBinary) {
+    const GLuint vs = CompileShader(GL_VERTEX_SHADER, vertexSource);
+    const GLuint fs = CompileShader(GL_FRAGMENT_SHADER, fragmentSource);
+    if (vs == 0 || fs == 0) {
+        if (vs != 0) {
+            glDeleteShader(vs);
+        }
+        if (fs != 0) {
+            glDeleteShader(fs);
+        }
+        return 0;
+    }
+
+    const GLuint program = LinkProgram(vs, fs, retrievableBinary);
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+    return program;
+}
+
+uint64_t HashBytesFnv1a(const void* data, size_t size, uint64_t hash = 14695981039346656037ull) {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * 1099511628211ull;
+    }
+    return hash;
+}
+
+// Program binaries are only valid for the driver that produced them, so the key covers the GL strings (the
+// version string carries the driver build on Adreno) as well as both sources.
+uint64_t ProgramBinaryKey(const char* vertexSource, const char* fragmentSource) {
+    uint64_t hash = HashBytesFnv1a(&kProgramBinaryMagic, sizeof(kProgramBinaryMagic));
+    for (const GLenum name : {GL_VENDOR, GL_RENDERER, GL_VERSION}) {
+        const char* text = reinterpret_cast<const char*>(glGetString(name));
+        if (text != nullptr) {
+            hash = HashBytesFnv1a(text, std::strlen(text) + 1, hash);
+        }
+    }
+    hash = HashBytesFnv1a(vertexSource, std::strlen(vertexSource) + 1, hash);
+    return HashBytesFnv1a(fragmentSource, std::strlen(fragmentSource) + 1, hash);
+}
+
+struct ProgramBinaryHeader {
+    uint32_t magic{kProgramBinaryMagic};
+    uint32_t format{0};
+    uint64_t key{0};
+    uint32_t length{0};
+    uint32_t reserved{0};
+};
+
+// Returns 0 when the file is missing or was written for other sources or another driver. A binary the driver
+// rejects is deleted so the next launch does not retry it.
+uint32_t LoadProgramBinary(const std::string& path, uint64_t key) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return 0;
+    }
+    ProgramBinaryHeader header;
+    if (!in.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.magic != kProgramBinaryMagic ||
+        header.key != key || header.length == 0 || header.length > kMaxProgramBinaryBytes) {
+        return 0;
+    }
+    std::vector<char> binary(header.length);
+    if (!in.read(binary.data(), static_cast<std::streamsize>(binary.size()))) {
+        return 0;
+    }
+    in.close();
+
+    const GLuint program = glCreateProgram();
+    glProgramBinary(program, static_cast<GLenum>(header.format), binary.data(), static_cast<GLsizei>(header.length));
+    GLint success = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if (success == GL_TRUE) {
+        return program;
+    }
+    glGetError();
+    glDeleteProgram(program);
+    std::remove(path.c_str());
+    LOGW("Cached program binary rejected by the driver: %s", path.c_str());
+    return 0;
+}
+
+// Written to a temporary file and renamed so a crash mid-write never leaves a truncated binary behind.
+bool StoreProgramBinary(const std::string& path, uint64_t key, uint32_t program) {
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0 || static_cast<uint32_t>(length) > kMaxProgramBinaryBytes) {
+        return false;
+    }
+    std::vector<char> binary(static_cast<size_t>(length));
+    GLsizei written = 0;
+    GLenum format = 0;
+    glGetProgramBinary(program, length, &written, &format, binary.data());
+    if (written <= 0) {
+        return false;
+    }
+
+    ProgramBinaryHeader header;
+    header.format = static_cast<uint32_t>(format);
+    header.key = key;
+    header.length = static_cast<uint32_t>(written);
+    const std::string tempPath = path + ".tmp";
+    {
+        std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            return false;
+        }
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(binary.data(), written);
+        if (!out) {
+            return false;
+        }
+    }
+    return std::rename(tempPath.c_str(), path.c_str()) == 0;
+}
+
 glm::mat4 BuildProjectionMatrix(const XrFovf& fov, float nearZ, float farZ) {
     const float tanLeft = std::tan(fov.angleLeft);
     const float tanRight = std::tan(fov.angleRight);
@@ -748,147 +1280,513 @@ bool ParseIntPairText(const std::string& text, int& firstOut, int& secondOut) {
     return false;
 }
 
-using GlyphRows = std::array<uint8_t, kHudGlyphHeight>;
-
-const GlyphRows& HudGlyphRows(char c) {
-    static const GlyphRows kSpace{{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-    static const GlyphRows kUnknown{{0x0E, 0x11, 0x01, 0x02, 0x04, 0x00, 0x04}};
-    static const GlyphRows kA{{0x0E, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11}};
-    static const GlyphRows kB{{0x1E, 0x11, 0x11, 0x1E, 0x11, 0x11, 0x1E}};
-    static const GlyphRows kC{{0x0E, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0E}};
-    static const GlyphRows kD{{0x1C, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1C}};
-    static const GlyphRows kE{{0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x1F}};
-    static const GlyphRows kF{{0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10}};
-    static const GlyphRows kG{{0x0E, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0F}};
-    static const GlyphRows kH{{0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11}};
-    static const GlyphRows kI{{0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E}};
-    static const GlyphRows kJ{{0x01, 0x01, 0x01, 0x01, 0x11, 0x11, 0x0E}};
-    static const GlyphRows kK{{0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11}};
-    static const GlyphRows kL{{0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F}};
-    static const GlyphRows kM{{0x11, 0x1B, 0x15, 0x15, 0x11, 0x11, 0x11}};
-    static const GlyphRows kN{{0x11, 0x19, 0x15, 0x13, 0x11, 0x11, 0x11}};
-    static const GlyphRows kO{{0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E}};
-    static const GlyphRows kP{{0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x10}};
-    static const GlyphRows kQ{{0x0E, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0D}};
-    static const GlyphRows kR{{0x1E, 0x11, 0x11, 0x1E, 0x14, 0x12, 0x11}};
-    static const GlyphRows kS{{0x0F, 0x10, 0x10, 0x0E, 0x01, 0x01, 0x1E}};
-    static const GlyphRows kT{{0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04}};
-    static const GlyphRows kU{{0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E}};
-    static const GlyphRows kV{{0x11, 0x11, 0x11, 0x11, 0x11, 0x0A, 0x04}};
-    static const GlyphRows kW{{0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0A}};
-    static const GlyphRows kX{{0x11, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x11}};
-    static const GlyphRows kY{{0x11, 0x11, 0x0A, 0x04, 0x04, 0x04, 0x04}};
-    static const GlyphRows kZ{{0x1F, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1F}};
-    static const GlyphRows k0{{0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E}};
-    static const GlyphRows k1{{0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E}};
-    static const GlyphRows k2{{0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F}};
-    static const GlyphRows k3{{0x1E, 0x01, 0x01, 0x0E, 0x01, 0x01, 0x1E}};
-    static const GlyphRows k4{{0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02}};
-    static const GlyphRows k5{{0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E}};
-    static const GlyphRows k6{{0x07, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E}};
-    static const GlyphRows k7{{0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08}};
-    static const GlyphRows k8{{0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E}};
-    static const GlyphRows k9{{0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x1C}};
-    static const GlyphRows kColon{{0x00, 0x04, 0x04, 0x00, 0x04, 0x04, 0x00}};
-    static const GlyphRows kDot{{0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06}};
-    static const GlyphRows kDash{{0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00}};
-    static const GlyphRows kUnderscore{{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F}};
-    static const GlyphRows kSlash{{0x01, 0x02, 0x04, 0x08, 0x10, 0x00, 0x00}};
-    static const GlyphRows kOpenParen{{0x02, 0x04, 0x08, 0x08, 0x08, 0x04, 0x02}};
-    static const GlyphRows kCloseParen{{0x08, 0x04, 0x02, 0x02, 0x02, 0x04, 0x08}};
-    static const GlyphRows kHash{{0x0A, 0x0A, 0x1F, 0x0A, 0x1F, 0x0A, 0x0A}};
-    static const GlyphRows kPlus{{0x00, 0x04, 0x04, 0x1F, 0x04, 0x04, 0x00}};
-    static const GlyphRows kEqual{{0x00, 0x1F, 0x00, 0x1F, 0x00, 0x00, 0x00}};
+bool ParseFoveationLevelText(const std::string& text, FoveationLevel& levelOut) {
+    std::string normalized = TrimAscii(text);
+    std::transform(normalized.begin(),
+                   normalized.end(),
+                   normalized.begin(),
+                   [](unsigned char ch) { return static_cast<char>(std::tolower(ch)); });
 
-    switch (c) {
-        case 'A': return kA;
-        case 'B': return kB;
-        case 'C': return kC;
-        case 'D': return kD;
-        case 'E': return kE;
-        case 'F': return kF;
-        case 'G': return kG;
-        case 'H': return kH;
-        case 'I': return kI;
-        case 'J': return kJ;
-        case 'K': return kK;
-        case 'L': return kL;
-        case 'M': return kM;
-        case 'N': return kN;
-        case 'O': return kO;
-        case 'P': return kP;
-        case 'Q': return kQ;
-        case 'R': return kR;
-        case 'S': return kS;
-        case 'T': return kT;
-        case 'U': return kU;
-        case 'V': return kV;
-        case 'W': return kW;
-        case 'X': return kX;
-        case 'Y': return kY;
-        case 'Z': return kZ;
-        case '0': return k0;
-        case '1': return k1;
-        case '2': return k2;
-        case '3': return k3;
-        case '4': return k4;
-        case '5': return k5;
-        case '6': return k6;
-        case '7': return k7;
-        case '8': return k8;
-        case '9': return k9;
-        case ' ': return kSpace;
-        case ':': return kColon;
-        case '.': return kDot;
-        case '-': return kDash;
-        case '_': return kUnderscore;
-        case '/': return kSlash;
-        case '(': return kOpenParen;
-        case ')': return kCloseParen;
-        case '#': return kHash;
-        case '+': return kPlus;
-        case '=': return kEqual;
-        default: return kUnknown;
+    if (normalized == "0" || normalized == "off" || normalized == "none") {
+        levelOut = FoveationLevel::Off;
+        return true;
+    }
+    if (normalized == "1" || normalized == "low") {
+        levelOut = FoveationLevel::Low;
+        return true;
+    }
+    if (normalized == "2" || normalized == "medium" || normalized == "med") {
+        levelOut = FoveationLevel::Medium;
+        return true;
     }
+    if (normalized == "3" || normalized == "high") {
+        levelOut = FoveationLevel::High;
+        return true;
+    }
+    return false;
 }
 
-void SetHudPixel(std::vector<uint8_t>& texture, int x, int yTop, uint8_t alpha) {
-    if (x < 0 || x >= kHudTextTextureWidth || yTop < 0 || yTop >= kHudTextTextureHeight) {
-        return;
-    }
+bool ParseCaptureModeText(const std::string& text, CaptureMode& modeOut) {
+    std::string normalized = TrimAscii(text);
+    std::transform(normalized.begin(),
+                   normalized.end(),
+                   normalized.begin(),
+                   [](unsigned char ch) { return static_cast<char>(std::tolower(ch)); });
 
-    const int yBottom = (kHudTextTextureHeight - 1) - yTop;
-    const size_t index = static_cast<size_t>(yBottom * kHudTextTextureWidth + x);
-    texture[index] = std::max(texture[index], alpha);
+    if (normalized == "0" || normalized == "off" || normalized == "none") {
+        modeOut = CaptureMode::Off;
+        return true;
+    }
+    if (normalized == "1" || normalized == "projectm") {
+        modeOut = CaptureMode::ProjectM;
+        return true;
+    }
+    if (normalized == "eye") {
+        modeOut = CaptureMode::Eye;
+        return true;
+    }
+    if (normalized == "both") {
+        modeOut = CaptureMode::Both;
+        return true;
+    }
+    return false;
 }
 
-void DrawHudGlyph(std::vector<uint8_t>& texture, int xTopLeft, int yTopLeft, int scale, char c, uint8_t alpha) {
-    if (scale <= 0) {
-        return;
+// glReadPixels rows are bottom-up RGBA; a binary PPM is top-down RGB.
+bool WriteCapturePpm(const CaptureJob& job) {
+    FILE* file = std::fopen(job.path.c_str(), "wb");
+    if (file == nullptr) {
+        return false;
     }
-
-    const GlyphRows& rows = HudGlyphRows(c);
-    for (int row = 0; row < kHudGlyphHeight; ++row) {
-        for (int col = 0; col < kHudGlyphWidth; ++col) {
-            const int bit = kHudGlyphWidth - 1 - col;
-            if (((rows[static_cast<size_t>(row)] >> bit) & 0x01U) == 0U) {
-                continue;
-            }
-
-            for (int dy = 0; dy < scale; ++dy) {
-                for (int dx = 0; dx < scale; ++dx) {
-                    SetHudPixel(texture, xTopLeft + col * scale + dx, yTopLeft + row * scale + dy, alpha);
-                }
-            }
+    std::fprintf(file, "P6\n%d %d\n255\n", job.width, job.height);
+    std::vector<uint8_t> row(static_cast<size_t>(job.width) * 3);
+    bool ok = true;
+    for (int y = job.height - 1; y >= 0 && ok; --y) {
+        const uint8_t* src = job.pixels + static_cast<size_t>(y) * static_cast<size_t>(job.width) * 4;
+        for (int x = 0; x < job.width; ++x) {
+            row[static_cast<size_t>(x) * 3 + 0] = src[x * 4 + 0];
+            row[static_cast<size_t>(x) * 3 + 1] = src[x * 4 + 1];
+            row[static_cast<size_t>(x) * 3 + 2] = src[x * 4 + 2];
         }
+        ok = std::fwrite(row.data(), 1, row.size(), file) == row.size();
     }
+    return std::fclose(file) == 0 && ok;
 }
 
-int MeasureHudTextWidth(const std::string& text, int scale) {
-    if (text.empty() || scale <= 0) {
-        return 0;
+// Writes beside the target and renames over it, so neither a reader nor a crash ever sees a partial file.
+bool WriteFileReplacing(const std::string& path, const std::string& contents) {
+    const std::string tempPath = path + ".tmp";
+    FILE* file = std::fopen(tempPath.c_str(), "wb");
+    if (file == nullptr) {
+        return false;
     }
-    const int advance = (kHudGlyphWidth + 1) * scale;
+    const bool ok = std::fwrite(contents.data(), 1, contents.size(), file) == contents.size();
+    if (std::fclose(file) != 0 || !ok) {
+        std::remove(tempPath.c_str());
+        return false;
+    }
+    return std::rename(tempPath.c_str(), path.c_str()) == 0;
+}
+
+bool ParseIdleThrottleText(const std::string& text, IdleThrottle& throttleOut) {
+    std::string normalized = TrimAscii(text);
+    std::transform(normalized.begin(),
+                   normalized.end(),
+                   normalized.begin(),
+                   [](unsigned char ch) { return static_cast<char>(std::tolower(ch)); });
+
+    if (normalized == "0" || normalized == "off" || normalized == "full") {
+        throttleOut = IdleThrottle::Full;
+        return true;
+    }
+    if (normalized == "1" || normalized == "reduce" || normalized == "reduced") {
+        throttleOut = IdleThrottle::Reduced;
+        return true;
+    }
+    if (normalized == "2" || normalized == "freeze" || normalized == "frozen") {
+        throttleOut = IdleThrottle::Frozen;
+        return true;
+    }
+    return false;
+}
+
+bool ParsePresetTransitionModeText(const std::string& text, PresetTransitionMode& modeOut) {
+    std::string normalized = TrimAscii(text);
+    std::transform(normalized.begin(),
+                   normalized.end(),
+                   normalized.begin(),
+                   [](unsigned char ch) { return static_cast<char>(std::tolower(ch)); });
+
+    if (normalized == "auto") {
+        modeOut = PresetTransitionMode::Auto;
+        return true;
+    }
+    if (normalized == "smooth" || normalized == "blend") {
+        modeOut = PresetTransitionMode::Smooth;
+        return true;
+    }
+    if (normalized == "cut" || normalized == "hard") {
+        modeOut = PresetTransitionMode::Cut;
+        return true;
+    }
+    if (normalized == "snapshot" || normalized == "crossfade") {
+        modeOut = PresetTransitionMode::Snapshot;
+        return true;
+    }
+    return false;
+}
+
+const char* IdleThrottleLabel(IdleThrottle throttle) {
+    switch (throttle) {
+        case IdleThrottle::Full: return "full";
+        case IdleThrottle::Reduced: return "reduced";
+        case IdleThrottle::Frozen: return "frozen";
+        default: return "?";
+    }
+}
+
+const char* FoveationLevelLabel(FoveationLevel level) {
+    switch (level) {
+        case FoveationLevel::Off: return "OFF";
+        case FoveationLevel::Low: return "LOW";
+        case FoveationLevel::Medium: return "MED";
+        case FoveationLevel::High: return "HIGH";
+        default: return "?";
+    }
+}
+
+bool ParseCanvasMappingText(const std::string& text, CanvasMapping& mappingOut) {
+    std::string normalized = TrimAscii(text);
+    std::transform(normalized.begin(),
+                   normalized.end(),
+                   normalized.begin(),
+                   [](unsigned char ch) { return static_cast<char>(std::tolower(ch)); });
+
+    if (normalized == "equirect" || normalized == "equirectangular") {
+        mappingOut = CanvasMapping::Equirect;
+        return true;
+    }
+    if (normalized == "equal_area" || normalized == "equalarea" || normalized == "lambert") {
+        mappingOut = CanvasMapping::EqualArea;
+        return true;
+    }
+    if (normalized == "compressed") {
+        mappingOut = CanvasMapping::Compressed;
+        return true;
+    }
+    return false;
+}
+
+const char* CanvasMappingLabel(CanvasMapping mapping) {
+    switch (mapping) {
+        case CanvasMapping::EqualArea: return "equal-area";
+        case CanvasMapping::Compressed: return "compressed";
+        case CanvasMapping::Equirect:
+        default: return "equirect";
+    }
+}
+
+// Canvas height that keeps the equirect rows-per-degree at the equator. Equirect spends H/pi rows per radian
+// there; equal-area (v = sin(lat)/2) spends H/2, and Compressed averages the two mappings.
+float CanvasHeightScale(CanvasMapping mapping) {
+    constexpr float kInvPi = 0.318309886f;
+    switch (mapping) {
+        case CanvasMapping::EqualArea: return kInvPi / 0.5f;
+        case CanvasMapping::Compressed: return kInvPi / (0.5f * kInvPi + 0.25f);
+        case CanvasMapping::Equirect:
+        default: return 1.0f;
+    }
+}
+
+// Prior before any rung has been measured: projectM cost goes with pixels and (less so) mesh vertices, and
+// foveation trims the eye passes.
+void SeedQualityRungCost(QualityRung& rung) {
+    const float meshVertices = static_cast<float>(rung.meshWidth * rung.meshHeight) /
+                               static_cast<float>(kDefaultMeshWidth * kDefaultMeshHeight);
+    rung.projectMCost = rung.renderScale * rung.renderScale * (0.85f + 0.15f * meshVertices);
+    static constexpr std::array<float, 4> kFoveationEyeCost = {1.0f, 0.9f, 0.8f, 0.7f};
+    rung.eyeCost = kFoveationEyeCost[static_cast<size_t>(rung.foveation)];
+}
+
+// Rungs are separated by ';' and each is "render_scale/mesh/foveation/refresh_hz",
+// e.g. "0.58/64x48/medium/72". Any malformed rung rejects the whole ladder.
+bool ParseQualityLadderText(const std::string& text, std::vector<QualityRung>& ladderOut) {
+    std::vector<QualityRung> ladder;
+    size_t rungStart = 0;
+    while (rungStart <= text.size()) {
+        const size_t rungEnd = std::min(text.find(';', rungStart), text.size());
+        const std::string rungText = TrimAscii(text.substr(rungStart, rungEnd - rungStart));
+        rungStart = rungEnd + 1;
+        if (rungText.empty()) {
+            continue;
+        }
+
+        std::array<std::string, 4> fields;
+        size_t fieldCount = 0;
+        size_t fieldStart = 0;
+        while (fieldStart <= rungText.size() && fieldCount < fields.size()) {
+            const size_t fieldEnd = std::min(rungText.find('/', fieldStart), rungText.size());
+            fields[fieldCount++] = rungText.substr(fieldStart, fieldEnd - fieldStart);
+            fieldStart = fieldEnd + 1;
+        }
+        if (fieldCount != fields.size() || fieldStart <= rungText.size()) {
+            return false;
+        }
+
+        QualityRung rung;
+        if (!ParseFloatText(fields[0], rung.renderScale) ||
+            !ParseIntPairText(fields[1], rung.meshWidth, rung.meshHeight) ||
+            !ParseFoveationLevelText(fields[2], rung.foveation) ||
+            !ParseFloatText(fields[3], rung.refreshHz)) {
+            return false;
+        }
+        rung.renderScale = std::clamp(rung.renderScale, kMinProjectMRenderScale, 1.0f);
+        rung.meshWidth = std::clamp(rung.meshWidth, 16, 128);
+        rung.meshHeight = std::clamp(rung.meshHeight, 12, 128);
+        rung.refreshHz = std::clamp(rung.refreshHz, 0.0f, 144.0f);
+        SeedQualityRungCost(rung);
+        ladder.push_back(rung);
+        if (ladder.size() > kMaxQualityRungs) {
+            return false;
+        }
+    }
+    if (ladder.empty()) {
+        return false;
+    }
+    ladderOut = std::move(ladder);
+    return true;
+}
+
+// Levers set through their own properties. The governor keeps a pinned lever at that value on every rung.
+struct QualityLeverPins {
+    bool renderScale{false};
+    bool mesh{false};
+    bool foveation{false};
+    bool refreshHz{false};
+    QualityRung values;
+};
+
+bool SameQualityRungSettings(const QualityRung& a, const QualityRung& b) {
+    return std::fabs(a.renderScale - b.renderScale) < 0.0005f && a.meshWidth == b.meshWidth &&
+           a.meshHeight == b.meshHeight && a.foveation == b.foveation &&
+           std::fabs(a.refreshHz - b.refreshHz) < 0.5f;
+}
+
+// Overrides the pinned levers on every rung, then drops rungs that pinning made identical to the one above.
+void PinQualityLadderLevers(const QualityLeverPins& pins, std::vector<QualityRung>& ladder) {
+    std::vector<QualityRung> pinned;
+    for (QualityRung rung : ladder) {
+        if (pins.renderScale) {
+            rung.renderScale = pins.values.renderScale;
+        }
+        if (pins.mesh) {
+            rung.meshWidth = pins.values.meshWidth;
+            rung.meshHeight = pins.values.meshHeight;
+        }
+        if (pins.foveation) {
+            rung.foveation = pins.values.foveation;
+        }
+        if (pins.refreshHz) {
+            rung.refreshHz = pins.values.refreshHz;
+        }
+        SeedQualityRungCost(rung);
+        if (pinned.empty() || !SameQualityRungSettings(pinned.back(), rung)) {
+            pinned.push_back(rung);
+        }
+    }
+    ladder = std::move(pinned);
+}
+
+std::string FormatPerfLeverValue(const char* format, double value) {
+    char text[32];
+    std::snprintf(text, sizeof(text), format, value);
+    return text;
+}
+
+std::string FormatQualityRung(const QualityRung& rung) {
+    char refreshText[16] = "default";
+    if (rung.refreshHz > 0.0f) {
+        std::snprintf(refreshText, sizeof(refreshText), "%.0fHz", static_cast<double>(rung.refreshHz));
+    }
+    char text[64] = {};
+    std::snprintf(text,
+                  sizeof(text),
+                  "%.2f %dx%d %s %s",
+                  static_cast<double>(rung.renderScale),
+                  rung.meshWidth,
+                  rung.meshHeight,
+                  FoveationLevelLabel(rung.foveation),
+                  refreshText);
+    return text;
+}
+
+bool ParseRenderTargetFormatText(const std::string& text, RenderTargetFormat& formatOut) {
+    std::string normalized = TrimAscii(text);
+    std::transform(normalized.begin(),
+                   normalized.end(),
+                   normalized.begin(),
+                   [](unsigned char ch) { return static_cast<char>(std::tolower(ch)); });
+
+    if (normalized == "auto") {
+        formatOut = RenderTargetFormat::Auto;
+        return true;
+    }
+    if (normalized == "rgba8") {
+        formatOut = RenderTargetFormat::Rgba8;
+        return true;
+    }
+    if (normalized == "rgb565") {
+        formatOut = RenderTargetFormat::Rgb565;
+        return true;
+    }
+    if (normalized == "rgb10a2" || normalized == "rgb10_a2") {
+        formatOut = RenderTargetFormat::Rgb10A2;
+        return true;
+    }
+    if (normalized == "r11g11b10f" || normalized == "r11f_g11f_b10f") {
+        formatOut = RenderTargetFormat::R11G11B10F;
+        return true;
+    }
+    return false;
+}
+
+RenderTargetFormatInfo GetRenderTargetFormatInfo(RenderTargetFormat format) {
+    switch (format) {
+        case RenderTargetFormat::Rgb565: return {GL_RGB565, 2, "RGB565"};
+        case RenderTargetFormat::Rgb10A2: return {GL_RGB10_A2, 4, "RGB10_A2"};
+        case RenderTargetFormat::R11G11B10F: return {GL_R11F_G11F_B10F, 4, "R11F_G11F_B10F"};
+        case RenderTargetFormat::Auto:
+        case RenderTargetFormat::Rgba8:
+        default: return {GL_RGBA8, 4, "RGBA8"};
+    }
+}
+
+using GlyphRows = std::array<uint8_t, kHudGlyphHeight>;
+
+const GlyphRows& HudGlyphRows(char c) {
+    static const GlyphRows kSpace{{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+    static const GlyphRows kUnknown{{0x0E, 0x11, 0x01, 0x02, 0x04, 0x00, 0x04}};
+    static const GlyphRows kA{{0x0E, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11}};
+    static const GlyphRows kB{{0x1E, 0x11, 0x11, 0x1E, 0x11, 0x11, 0x1E}};
+    static const GlyphRows kC{{0x0E, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0E}};
+    static const GlyphRows kD{{0x1C, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1C}};
+    static const GlyphRows kE{{0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x1F}};
+    static const GlyphRows kF{{0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10}};
+    static const GlyphRows kG{{0x0E, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0F}};
+    static const GlyphRows kH{{0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11}};
+    static const GlyphRows kI{{0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E}};
+    static const GlyphRows kJ{{0x01, 0x01, 0x01, 0x01, 0x11, 0x11, 0x0E}};
+    static const GlyphRows kK{{0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11}};
+    static const GlyphRows kL{{0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F}};
+    static const GlyphRows kM{{0x11, 0x1B, 0x15, 0x15, 0x11, 0x11, 0x11}};
+    static const GlyphRows kN{{0x11, 0x19, 0x15, 0x13, 0x11, 0x11, 0x11}};
+    static const GlyphRows kO{{0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E}};
+    static const GlyphRows kP{{0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x10}};
+    static const GlyphRows kQ{{0x0E, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0D}};
+    static const GlyphRows kR{{0x1E, 0x11, 0x11, 0x1E, 0x14, 0x12, 0x11}};
+    static const GlyphRows kS{{0x0F, 0x10, 0x10, 0x0E, 0x01, 0x01, 0x1E}};
+    static const GlyphRows kT{{0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04}};
+    static const GlyphRows kU{{0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E}};
+    static const GlyphRows kV{{0x11, 0x11, 0x11, 0x11, 0x11, 0x0A, 0x04}};
+    static const GlyphRows kW{{0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0A}};
+    static const GlyphRows kX{{0x11, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x11}};
+    static const GlyphRows kY{{0x11, 0x11, 0x0A, 0x04, 0x04, 0x04, 0x04}};
+    static const GlyphRows kZ{{0x1F, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1F}};
+    static const GlyphRows k0{{0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E}};
+    static const GlyphRows k1{{0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E}};
+    static const GlyphRows k2{{0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F}};
+    static const GlyphRows k3{{0x1E, 0x01, 0x01, 0x0E, 0x01, 0x01, 0x1E}};
+    static const GlyphRows k4{{0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02}};
+    static const GlyphRows k5{{0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E}};
+    static const GlyphRows k6{{0x07, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E}};
+    static const GlyphRows k7{{0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08}};
+    static const GlyphRows k8{{0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E}};
+    static const GlyphRows k9{{0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x1C}};
+    static const GlyphRows kColon{{0x00, 0x04, 0x04, 0x00, 0x04, 0x04, 0x00}};
+    static const GlyphRows kDot{{0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06}};
+    static const GlyphRows kDash{{0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00}};
+    static const GlyphRows kUnderscore{{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F}};
+    static const GlyphRows kSlash{{0x01, 0x02, 0x04, 0x08, 0x10, 0x00, 0x00}};
+    static const GlyphRows kOpenParen{{0x02, 0x04, 0x08, 0x08, 0x08, 0x04, 0x02}};
+    static const GlyphRows kCloseParen{{0x08, 0x04, 0x02, 0x02, 0x02, 0x04, 0x08}};
+    static const GlyphRows kHash{{0x0A, 0x0A, 0x1F, 0x0A, 0x1F, 0x0A, 0x0A}};
+    static const GlyphRows kPlus{{0x00, 0x04, 0x04, 0x1F, 0x04, 0x04, 0x00}};
+    static const GlyphRows kEqual{{0x00, 0x1F, 0x00, 0x1F, 0x00, 0x00, 0x00}};
+
+    switch (c) {
+        case 'A': return kA;
+        case 'B': return kB;
+        case 'C': return kC;
+        case 'D': return kD;
+        case 'E': return kE;
+        case 'F': return kF;
+        case 'G': return kG;
+        case 'H': return kH;
+        case 'I': return kI;
+        case 'J': return kJ;
+        case 'K': return kK;
+        case 'L': return kL;
+        case 'M': return kM;
+        case 'N': return kN;
+        case 'O': return kO;
+        case 'P': return kP;
+        case 'Q': return kQ;
+        case 'R': return kR;
+        case 'S': return kS;
+        case 'T': return kT;
+        case 'U': return kU;
+        case 'V': return kV;
+        case 'W': return kW;
+        case 'X': return kX;
+        case 'Y': return kY;
+        case 'Z': return kZ;
+        case '0': return k0;
+        case '1': return k1;
+        case '2': return k2;
+        case '3': return k3;
+        case '4': return k4;
+        case '5': return k5;
+        case '6': return k6;
+        case '7': return k7;
+        case '8': return k8;
+        case '9': return k9;
+        case ' ': return kSpace;
+        case ':': return kColon;
+        case '.': return kDot;
+        case '-': return kDash;
+        case '_': return kUnderscore;
+        case '/': return kSlash;
+        case '(': return kOpenParen;
+        case ')': return kCloseParen;
+        case '#': return kHash;
+        case '+': return kPlus;
+        case '=': return kEqual;
+        default: return kUnknown;
+    }
+}
+
+// Glyph masks pre-expanded to each HUD scale: one (kHudGlyphWidth * scale) x (kHudGlyphHeight * scale) cell per
+// ASCII code, top row first, 0xFF where the glyph is set. Blitting a label is then a masked max per row.
+struct HudGlyphAtlas {
+    int cellWidth{0};
+    int cellHeight{0};
+    std::vector<uint8_t> cells;
+};
+
+constexpr int kMaxHudGlyphScale = 4;
+constexpr int kHudGlyphAtlasCodes = 128;
+
+const HudGlyphAtlas& HudGlyphAtlasForScale(int scale) {
+    static const std::array<HudGlyphAtlas, kMaxHudGlyphScale + 1> kAtlases = []() {
+        std::array<HudGlyphAtlas, kMaxHudGlyphScale + 1> atlases{};
+        for (int atlasScale = 1; atlasScale <= kMaxHudGlyphScale; ++atlasScale) {
+            HudGlyphAtlas& atlas = atlases[static_cast<size_t>(atlasScale)];
+            atlas.cellWidth = kHudGlyphWidth * atlasScale;
+            atlas.cellHeight = kHudGlyphHeight * atlasScale;
+            const size_t cellSize = static_cast<size_t>(atlas.cellWidth * atlas.cellHeight);
+            atlas.cells.assign(cellSize * kHudGlyphAtlasCodes, 0);
+            for (int code = 0; code < kHudGlyphAtlasCodes; ++code) {
+                const GlyphRows& rows = HudGlyphRows(static_cast<char>(code));
+                uint8_t* cell = atlas.cells.data() + cellSize * static_cast<size_t>(code);
+                for (int y = 0; y < atlas.cellHeight; ++y) {
+                    const uint8_t bits = rows[static_cast<size_t>(y / atlasScale)];
+                    for (int x = 0; x < atlas.cellWidth; ++x) {
+                        const int bit = kHudGlyphWidth - 1 - x / atlasScale;
+                        cell[y * atlas.cellWidth + x] = ((bits >> bit) & 0x01U) != 0U ? 0xFF : 0x00;
+                    }
+                }
+            }
+        }
+        return atlases;
+    }();
+    return kAtlases[static_cast<size_t>(std::clamp(scale, 1, kMaxHudGlyphScale))];
+}
+
+int MeasureHudTextWidth(const std::string& text, int scale) {
+    if (text.empty() || scale <= 0) {
+        return 0;
+    }
+    const int advance = (kHudGlyphWidth + 1) * scale;
     return static_cast<int>(text.size()) * advance - scale;
 }
 
@@ -962,18 +1860,170 @@ std::string FitHudTextToWidth(const std::string& text, int scale, int maxPixelWi
 }
 
 void DrawHudText(std::vector<uint8_t>& texture, int xTopLeft, int yTopLeft, int scale, const std::string& text, uint8_t alpha) {
-    if (text.empty() || scale <= 0) {
+    if (text.empty() || scale <= 0 || scale > kMaxHudGlyphScale) {
         return;
     }
 
+    const HudGlyphAtlas& atlas = HudGlyphAtlasForScale(scale);
+    const size_t cellSize = static_cast<size_t>(atlas.cellWidth * atlas.cellHeight);
+    const int rowBegin = std::max(0, -yTopLeft);
+    const int rowEnd = std::min(atlas.cellHeight, kHudTextTextureHeight - yTopLeft);
     const int advance = (kHudGlyphWidth + 1) * scale;
     int cursor = xTopLeft;
     for (const char c : text) {
-        DrawHudGlyph(texture, cursor, yTopLeft, scale, c, alpha);
+        const int colBegin = std::max(0, -cursor);
+        const int colEnd = std::min(atlas.cellWidth, kHudTextTextureWidth - cursor);
+        const unsigned char code = static_cast<unsigned char>(c);
+        if (code < kHudGlyphAtlasCodes && c != ' ' && colBegin < colEnd) {
+            const uint8_t* cell = atlas.cells.data() + cellSize * code;
+            for (int row = rowBegin; row < rowEnd; ++row) {
+                // The texture is stored bottom-up for GL.
+                const int yBottom = (kHudTextTextureHeight - 1) - (yTopLeft + row);
+                uint8_t* dst = texture.data() + static_cast<size_t>(yBottom * kHudTextTextureWidth + cursor);
+                const uint8_t* mask = cell + row * atlas.cellWidth;
+                for (int col = colBegin; col < colEnd; ++col) {
+                    dst[col] = std::max(dst[col], static_cast<uint8_t>(mask[col] & alpha));
+                }
+            }
+        }
         cursor += advance;
     }
 }
 
+// Where DrawHudText would put `text` centered in `layout.rect`, after fitting it to the rect width.
+struct HudTextPlacement {
+    std::string text;
+    HudPixelRect bounds;
+};
+
+HudTextPlacement PlaceHudTextCentered(const HudTextLabelLayout& layout, const std::string& text) {
+    HudTextPlacement placement;
+    if (text.empty()) {
+        return placement;
+    }
+
+    const int scale = layout.scale;
+    const int rectMinX = static_cast<int>(layout.rect.minU * static_cast<float>(kHudTextTextureWidth));
+    const int rectMaxX = static_cast<int>(layout.rect.maxU * static_cast<float>(kHudTextTextureWidth));
+    const int rectTop = static_cast<int>((1.0f - layout.rect.maxV) * static_cast<float>(kHudTextTextureHeight));
+    const int rectBottom = static_cast<int>((1.0f - layout.rect.minV) * static_cast<float>(kHudTextTextureHeight));
+
+    const int rectWidth = std::max(0, rectMaxX - rectMinX);
+    const int horizontalPadding = std::max(2, scale);
+    const int usableWidth = std::max(0, rectWidth - horizontalPadding * 2);
+    placement.text = FitHudTextToWidth(text, scale, usableWidth);
+    if (placement.text.empty()) {
+        return placement;
+    }
+
+    const int textWidth = MeasureHudTextWidth(placement.text, scale);
+    const int textHeight = kHudGlyphHeight * scale;
+    placement.bounds.x = rectMinX + horizontalPadding + std::max(0, (usableWidth - textWidth) / 2);
+    placement.bounds.y = rectTop + std::max(0, (rectBottom - rectTop - textHeight) / 2);
+    placement.bounds.width = textWidth;
+    placement.bounds.height = textHeight;
+    return placement;
+}
+
+bool HudPixelRectsIntersect(const HudPixelRect& a, const HudPixelRect& b) {
+    return a.width > 0 && a.height > 0 && b.width > 0 && b.height > 0 &&
+           a.x < b.x + b.width && b.x < a.x + a.width &&
+           a.y < b.y + b.height && b.y < a.y + a.height;
+}
+
+HudPixelRect ClipHudPixelRect(const HudPixelRect& rect) {
+    HudPixelRect clipped;
+    clipped.x = std::clamp(rect.x, 0, kHudTextTextureWidth);
+    clipped.y = std::clamp(rect.y, 0, kHudTextTextureHeight);
+    clipped.width = std::clamp(rect.x + rect.width, 0, kHudTextTextureWidth) - clipped.x;
+    clipped.height = std::clamp(rect.y + rect.height, 0, kHudTextTextureHeight) - clipped.y;
+    return clipped;
+}
+
+void ClearHudPixelRect(std::vector<uint8_t>& texture, const HudPixelRect& rect) {
+    const HudPixelRect clipped = ClipHudPixelRect(rect);
+    for (int row = 0; row < clipped.height; ++row) {
+        const int yBottom = (kHudTextTextureHeight - 1) - (clipped.y + row);
+        uint8_t* dst = texture.data() + static_cast<size_t>(yBottom * kHudTextTextureWidth + clipped.x);
+        std::memset(dst, 0, static_cast<size_t>(std::max(clipped.width, 0)));
+    }
+}
+
+const char* GpuPassLabel(GpuPass pass) {
+    switch (pass) {
+        case GpuPass::ProjectM:
+            return "projectM";
+        case GpuPass::Upscale:
+            return "upscale";
+        case GpuPass::Eye:
+            return "eye";
+        case GpuPass::Hud:
+            return "hud";
+        case GpuPass::Hands:
+            return "hands";
+        case GpuPass::Count:
+            break;
+    }
+    return "?";
+}
+
+std::string FormatGpuPassStats(const std::array<GpuPassStats, kGpuPassCount>& stats) {
+    std::string text;
+    char entry[64] = {};
+    for (size_t i = 0; i < kGpuPassCount; ++i) {
+        if (stats[i].samples == 0) {
+            continue;
+        }
+        std::snprintf(entry,
+                      sizeof(entry),
+                      "%s%s=%.2f/%.2f/%.2f",
+                      text.empty() ? "" : " ",
+                      GpuPassLabel(static_cast<GpuPass>(i)),
+                      static_cast<double>(stats[i].avgMs),
+                      static_cast<double>(stats[i].p50Ms),
+                      static_cast<double>(stats[i].p95Ms));
+        text += entry;
+    }
+    return text.empty() ? std::string("n/a") : text;
+}
+
+void AddPassSample(PassSampleWindow& window, float ms) {
+    window.samples[window.next] = ms;
+    window.next = (window.next + 1) % window.samples.size();
+    window.count = std::min(window.count + 1, window.samples.size());
+}
+
+GpuPassStats ComputePassStats(const PassSampleWindow& window) {
+    GpuPassStats stats;
+    if (window.count == 0) {
+        return stats;
+    }
+    std::array<float, kGpuPassSampleWindow> sorted{};
+    std::copy_n(window.samples.begin(), window.count, sorted.begin());
+    std::sort(sorted.begin(), sorted.begin() + static_cast<std::ptrdiff_t>(window.count));
+    double sum = 0.0;
+    for (size_t i = 0; i < window.count; ++i) {
+        sum += static_cast<double>(sorted[i]);
+    }
+    auto percentile = [&](double fraction) {
+        const size_t index = static_cast<size_t>(fraction * static_cast<double>(window.count - 1) + 0.5);
+        return sorted[std::min(index, window.count - 1)];
+    };
+    const double mean = sum / static_cast<double>(window.count);
+    double squaredDeviation = 0.0;
+    for (size_t i = 0; i < window.count; ++i) {
+        const double deviation = static_cast<double>(sorted[i]) - mean;
+        squaredDeviation += deviation * deviation;
+    }
+    stats.avgMs = static_cast<float>(mean);
+    stats.stddevMs = static_cast<float>(std::sqrt(squaredDeviation / static_cast<double>(window.count)));
+    stats.p50Ms = percentile(0.50);
+    stats.p95Ms = percentile(0.95);
+    stats.maxMs = sorted[window.count - 1];
+    stats.samples = static_cast<uint32_t>(window.count);
+    return stats;
+}
+
 class QuestVisualizerApp {
 public:
     explicit QuestVisualizerApp(android_app* app)
@@ -992,6 +2042,7 @@ public:
             LOGE("Initialization failed.");
             return;
         }
+        initializedSeconds_ = ElapsedSeconds();
 
         while (!exitRenderLoop_ && app_->destroyRequested == 0) {
             ProcessAndroidEvents();
@@ -1022,6 +2073,7 @@ private:
             case APP_CMD_PAUSE:
                 resumed_ = false;
                 LOGI("APP_CMD_PAUSE");
+                FlushPresetGpuCosts();
                 break;
             case APP_CMD_INIT_WINDOW:
                 hasWindow_ = true;
@@ -1341,13 +2393,26 @@ private:
             return false;
         }
 
-        LOGI("EGL ready. Renderer: %s", reinterpret_cast<const char*>(glGetString(GL_RENDERER)));
+        const char* renderer = reinterpret_cast<const char*>(glGetString(GL_RENDERER));
+        const char* extensions = reinterpret_cast<const char*>(glGetString(GL_EXTENSIONS));
+        colorBufferFloatSupported_ =
+            extensions != nullptr && std::strstr(extensions, "GL_EXT_color_buffer_float") != nullptr;
+        glRendererName_ = renderer != nullptr ? renderer : "";
+        LOGI("EGL ready. Renderer: %s", renderer != nullptr ? renderer : "unknown");
         return true;
     }
 
     bool InitializeOpenXr() {
         handTrackingExtensionEnabled_ = false;
         handTrackingReady_ = false;
+        foveationExtensionEnabled_ = false;
+        foveationReady_ = false;
+        displayRefreshRateExtensionEnabled_ = false;
+        displayRefreshRateReady_ = false;
+        performanceSettingsExtensionEnabled_ = false;
+        performanceSettingsReady_ = false;
+        spaceWarpExtensionEnabled_ = false;
+        spaceWarpReady_ = false;
 
         PFN_xrInitializeLoaderKHR initializeLoader = nullptr;
         xrGetInstanceProcAddr(XR_NULL_HANDLE, "xrInitializeLoaderKHR",
@@ -1415,6 +2480,48 @@ private:
         } else {
             LOGW("XR_EXT_hand_tracking not reported by runtime; tracked hand-joint rendering unavailable.");
         }
+        if (hasInstanceExtension(XR_FB_FOVEATION_EXTENSION_NAME) &&
+            hasInstanceExtension(XR_FB_FOVEATION_CONFIGURATION_EXTENSION_NAME) &&
+            hasInstanceExtension(XR_FB_SWAPCHAIN_UPDATE_STATE_EXTENSION_NAME)) {
+            requiredExtensions.push_back(XR_FB_FOVEATION_EXTENSION_NAME);
+            requiredExtensions.push_back(XR_FB_FOVEATION_CONFIGURATION_EXTENSION_NAME);
+            requiredExtensions.push_back(XR_FB_SWAPCHAIN_UPDATE_STATE_EXTENSION_NAME);
+            foveationExtensionEnabled_ = true;
+            LOGI("Enabling XR_FB_foveation for fixed/dynamic foveated eye rendering.");
+        } else {
+            LOGW("XR_FB_foveation not reported by runtime; eye buffers render without foveation.");
+        }
+        if (hasInstanceExtension(XR_EXT_PERFORMANCE_SETTINGS_EXTENSION_NAME)) {
+            requiredExtensions.push_back(XR_EXT_PERFORMANCE_SETTINGS_EXTENSION_NAME);
+            performanceSettingsExtensionEnabled_ = true;
+            LOGI("Enabling XR_EXT_performance_settings for CPU/GPU level hints.");
+        } else {
+            LOGW("XR_EXT_performance_settings not reported by runtime; clocks stay at runtime defaults.");
+        }
+        if (hasInstanceExtension(XR_FB_SPACE_WARP_EXTENSION_NAME)) {
+            requiredExtensions.push_back(XR_FB_SPACE_WARP_EXTENSION_NAME);
+            spaceWarpExtensionEnabled_ = true;
+            LOGI("Enabling XR_FB_space_warp for half-rate rendering under load.");
+        } else {
+            LOGW("XR_FB_space_warp not reported by runtime; SpaceWarp unavailable.");
+        }
+#ifdef XR_EXT_user_presence
+        if (hasInstanceExtension(XR_EXT_USER_PRESENCE_EXTENSION_NAME)) {
+            requiredExtensions.push_back(XR_EXT_USER_PRESENCE_EXTENSION_NAME);
+            userPresenceExtensionEnabled_ = true;
+            LOGI("Enabling XR_EXT_user_presence to throttle projectM while the headset is off.");
+        } else {
+            LOGW("XR_EXT_user_presence not reported by runtime; idle throttle follows session focus only.");
+        }
+#endif
+        if (hasInstanceExtension(XR_FB_DISPLAY_REFRESH_RATE_EXTENSION_NAME)) {
+            requiredExtensions.push_back(XR_FB_DISPLAY_REFRESH_RATE_EXTENSION_NAME);
+            displayRefreshRateExtensionEnabled_ = true;
+            LOGI("Enabling XR_FB_display_refresh_rate for refresh-rate selection.");
+        } else {
+            LOGW("XR_FB_display_refresh_rate not reported by runtime; assuming %.0f Hz.",
+                 static_cast<double>(kReferenceDisplayRefreshRate));
+        }
 
         XrInstanceCreateInfoAndroidKHR androidInfo{XR_TYPE_INSTANCE_CREATE_INFO_ANDROID_KHR};
         androidInfo.applicationVM = app_->activity->vm;
@@ -1523,6 +2630,27 @@ private:
             return false;
         }
 
+        if (performanceSettingsExtensionEnabled_ && !InitializePerformanceSettings()) {
+            LOGW("OpenXR performance settings unavailable; clocks stay at runtime defaults.");
+            performanceSettingsReady_ = false;
+        }
+
+        if (displayRefreshRateExtensionEnabled_ && !InitializeDisplayRefreshRate()) {
+            LOGW("OpenXR display refresh rate control unavailable; assuming %.0f Hz.",
+                 static_cast<double>(activeDisplayRefreshRate_));
+            displayRefreshRateReady_ = false;
+        }
+
+        if (foveationExtensionEnabled_ && !InitializeFoveation()) {
+            LOGW("OpenXR foveation unavailable; continuing without foveated eye buffers.");
+            foveationReady_ = false;
+        }
+
+        if (spaceWarpExtensionEnabled_ && !InitializeSpaceWarp()) {
+            LOGW("OpenXR SpaceWarp unavailable; continuing at full frame rate only.");
+            DestroySpaceWarpResources();
+        }
+
         glGenFramebuffers(1, &swapchainFramebuffer_);
         if (swapchainFramebuffer_ == 0) {
             LOGE("Failed to create swapchain framebuffer.");
@@ -1533,18 +2661,51 @@ private:
         return true;
     }
 
-    bool CreateSwapchains() {
+    bool EnumerateSwapchainFormats(std::vector<int64_t>& formats) {
         uint32_t formatCount = 0;
         if (XR_FAILED(xrEnumerateSwapchainFormats(xrSession_, 0, &formatCount, nullptr))) {
             LOGE("xrEnumerateSwapchainFormats count failed.");
             return false;
         }
 
-        std::vector<int64_t> formats(formatCount);
+        formats.resize(formatCount);
         if (XR_FAILED(xrEnumerateSwapchainFormats(xrSession_, formatCount, &formatCount, formats.data()))) {
             LOGE("xrEnumerateSwapchainFormats list failed.");
             return false;
         }
+        formats.resize(formatCount);
+        return true;
+    }
+
+    bool EnumerateSwapchainImages(XrSwapchainBundle& swapchain) {
+        uint32_t imageCount = 0;
+        if (XR_FAILED(xrEnumerateSwapchainImages(
+                swapchain.handle, 0, &imageCount, nullptr))) {
+            LOGE("xrEnumerateSwapchainImages count failed.");
+            return false;
+        }
+
+        swapchain.images.resize(imageCount);
+        for (auto& image : swapchain.images) {
+            image = {};
+            image.type = XR_TYPE_SWAPCHAIN_IMAGE_OPENGL_ES_KHR;
+        }
+        if (XR_FAILED(xrEnumerateSwapchainImages(
+                swapchain.handle,
+                imageCount,
+                &imageCount,
+                reinterpret_cast<XrSwapchainImageBaseHeader*>(swapchain.images.data())))) {
+            LOGE("xrEnumerateSwapchainImages failed.");
+            return false;
+        }
+        return true;
+    }
+
+    bool CreateSwapchains() {
+        std::vector<int64_t> formats;
+        if (!EnumerateSwapchainFormats(formats)) {
+            return false;
+        }
 
         int64_t chosenFormat = 0;
         const int64_t preferredFormats[] = {GL_SRGB8_ALPHA8, GL_RGBA8};
@@ -1562,16 +2723,29 @@ private:
             return false;
         }
 
+        std::string eyeMaxScaleText;
+        float eyeMaxScale = kDefaultEyeBufferMaxScale;
+        if (ReadSystemProperty("debug.projectm.quest.eye.max_scale", eyeMaxScaleText)) {
+            ParseFloatText(eyeMaxScaleText, eyeMaxScale);
+        }
+        eyeBufferMaxScale_ = std::clamp(eyeMaxScale, 1.0f, kMaxEyeBufferAllocationScale);
+
         swapchains_.resize(viewConfigs_.size());
 
         for (size_t i = 0; i < viewConfigs_.size(); ++i) {
+            // Allocate once at the largest size the governor may use; per-frame resolution changes only move
+            // the sub-image rect, so eye-buffer fill rate can shrink without reallocating swapchains.
+            const uint32_t recommendedWidth = viewConfigs_[i].recommendedImageRectWidth;
+            const uint32_t recommendedHeight = viewConfigs_[i].recommendedImageRectHeight;
             XrSwapchainCreateInfo createInfo{XR_TYPE_SWAPCHAIN_CREATE_INFO};
             createInfo.arraySize = 1;
             createInfo.mipCount = 1;
             createInfo.faceCount = 1;
             createInfo.format = chosenFormat;
-            createInfo.width = static_cast<uint32_t>(viewConfigs_[i].recommendedImageRectWidth);
-            createInfo.height = static_cast<uint32_t>(viewConfigs_[i].recommendedImageRectHeight);
+            createInfo.width = std::min(viewConfigs_[i].maxImageRectWidth,
+                                        static_cast<uint32_t>(std::lround(recommendedWidth * eyeBufferMaxScale_)));
+            createInfo.height = std::min(viewConfigs_[i].maxImageRectHeight,
+                                         static_cast<uint32_t>(std::lround(recommendedHeight * eyeBufferMaxScale_)));
             createInfo.sampleCount = viewConfigs_[i].recommendedSwapchainSampleCount;
             createInfo.usageFlags = XR_SWAPCHAIN_USAGE_COLOR_ATTACHMENT_BIT | XR_SWAPCHAIN_USAGE_SAMPLED_BIT;
 
@@ -1582,33 +2756,218 @@ private:
 
             swapchains_[i].width = static_cast<int32_t>(createInfo.width);
             swapchains_[i].height = static_cast<int32_t>(createInfo.height);
-
-            uint32_t imageCount = 0;
-            if (XR_FAILED(xrEnumerateSwapchainImages(
-                    swapchains_[i].handle, 0, &imageCount, nullptr))) {
-                LOGE("xrEnumerateSwapchainImages count failed.");
+            swapchains_[i].recommendedWidth = static_cast<int32_t>(recommendedWidth);
+            swapchains_[i].recommendedHeight = static_cast<int32_t>(recommendedHeight);
+            LOGI("Eye %zu swapchain allocated at %u x %u (recommended %u x %u)",
+                 i,
+                 createInfo.width,
+                 createInfo.height,
+                 recommendedWidth,
+                 recommendedHeight);
+
+            if (!EnumerateSwapchainImages(swapchains_[i])) {
                 return false;
             }
+        }
+
+        return true;
+    }
+
+    bool InitializeSpaceWarp() {
+        if (!spaceWarpExtensionEnabled_) {
+            return false;
+        }
+
+        XrSystemSpaceWarpPropertiesFB spaceWarpProperties{XR_TYPE_SYSTEM_SPACE_WARP_PROPERTIES_FB};
+        XrSystemProperties systemProperties{XR_TYPE_SYSTEM_PROPERTIES};
+        systemProperties.next = &spaceWarpProperties;
+        if (XR_FAILED(xrGetSystemProperties(xrInstance_, xrSystemId_, &systemProperties)) ||
+            spaceWarpProperties.recommendedMotionVectorImageRectWidth == 0 ||
+            spaceWarpProperties.recommendedMotionVectorImageRectHeight == 0) {
+            LOGW("XR_FB_space_warp system properties unavailable.");
+            return false;
+        }
 
-            swapchains_[i].images.resize(imageCount);
-            for (auto& image : swapchains_[i].images) {
-                image = {};
-                image.type = XR_TYPE_SWAPCHAIN_IMAGE_OPENGL_ES_KHR;
+        std::vector<int64_t> formats;
+        if (!EnumerateSwapchainFormats(formats)) {
+            return false;
+        }
+        auto hasFormat = [&formats](int64_t format) {
+            return std::find(formats.begin(), formats.end(), format) != formats.end();
+        };
+        if (!hasFormat(GL_RGBA16F) || !hasFormat(GL_DEPTH_COMPONENT24)) {
+            LOGW("SpaceWarp swapchain formats (RGBA16F motion / DEPTH24) not supported by runtime.");
+            return false;
+        }
+
+        const uint32_t width = spaceWarpProperties.recommendedMotionVectorImageRectWidth;
+        const uint32_t height = spaceWarpProperties.recommendedMotionVectorImageRectHeight;
+        auto createBundle = [&](int64_t format, XrSwapchainUsageFlags usage, XrSwapchainBundle& bundle) {
+            XrSwapchainCreateInfo createInfo{XR_TYPE_SWAPCHAIN_CREATE_INFO};
+            createInfo.arraySize = 1;
+            createInfo.mipCount = 1;
+            createInfo.faceCount = 1;
+            createInfo.sampleCount = 1;
+            createInfo.format = format;
+            createInfo.width = width;
+            createInfo.height = height;
+            createInfo.usageFlags = usage;
+            if (XR_FAILED(xrCreateSwapchain(xrSession_, &createInfo, &bundle.handle))) {
+                return false;
             }
-            if (XR_FAILED(xrEnumerateSwapchainImages(
-                    swapchains_[i].handle,
-                    imageCount,
-                    &imageCount,
-                    reinterpret_cast<XrSwapchainImageBaseHeader*>(swapchains_[i].images.data())))) {
-                LOGE("xrEnumerateSwapchainImages failed.");
+            bundle.width = static_cast<int32_t>(width);
+            bundle.height = static_cast<int32_t>(height);
+            bundle.recommendedWidth = bundle.width;
+            bundle.recommendedHeight = bundle.height;
+            return EnumerateSwapchainImages(bundle);
+        };
+
+        motionVectorSwapchains_.resize(viewConfigs_.size());
+        spaceWarpDepthSwapchains_.resize(viewConfigs_.size());
+        for (size_t i = 0; i < viewConfigs_.size(); ++i) {
+            if (!createBundle(GL_RGBA16F, XR_SWAPCHAIN_USAGE_COLOR_ATTACHMENT_BIT, motionVectorSwapchains_[i]) ||
+                !createBundle(GL_DEPTH_COMPONENT24,
+                              XR_SWAPCHAIN_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT,
+                              spaceWarpDepthSwapchains_[i])) {
+                LOGW("Failed to create SpaceWarp swapchains for eye %zu.", i);
                 return false;
             }
         }
 
+        glGenFramebuffers(1, &spaceWarpFramebuffer_);
+        if (spaceWarpFramebuffer_ == 0) {
+            LOGW("Failed to create SpaceWarp framebuffer.");
+            return false;
+        }
+
+        spaceWarpReady_ = true;
+        LOGI("OpenXR SpaceWarp initialized: motion/depth %u x %u", width, height);
         return true;
     }
 
+    void DestroySpaceWarpResources() {
+        if (spaceWarpFramebuffer_ != 0) {
+            glDeleteFramebuffers(1, &spaceWarpFramebuffer_);
+            spaceWarpFramebuffer_ = 0;
+        }
+        for (auto* bundles : {&motionVectorSwapchains_, &spaceWarpDepthSwapchains_}) {
+            for (auto& swapchain : *bundles) {
+                if (swapchain.handle != XR_NULL_HANDLE) {
+                    xrDestroySwapchain(swapchain.handle);
+                    swapchain.handle = XR_NULL_HANDLE;
+                }
+                swapchain.images.clear();
+            }
+            bundles->clear();
+        }
+        spaceWarpReady_ = false;
+    }
+
+    // projectM content sits on a sphere at effectively infinite distance, so head motion is fully covered by the
+    // runtime's pose reprojection; zero motion vectors and far-plane depth are enough for frame synthesis.
+    bool RenderSpaceWarpBuffers(size_t viewIndex, XrCompositionLayerSpaceWarpInfoFB& spaceWarpInfo) {
+        auto& motionSwapchain = motionVectorSwapchains_[viewIndex];
+        auto& depthSwapchain = spaceWarpDepthSwapchains_[viewIndex];
+
+        uint32_t motionImageIndex = 0;
+        uint32_t depthImageIndex = 0;
+        XrSwapchainImageAcquireInfo acquireInfo{XR_TYPE_SWAPCHAIN_IMAGE_ACQUIRE_INFO};
+        XrSwapchainImageWaitInfo waitImageInfo{XR_TYPE_SWAPCHAIN_IMAGE_WAIT_INFO};
+        waitImageInfo.timeout = XR_INFINITE_DURATION;
+        XrSwapchainImageReleaseInfo releaseInfo{XR_TYPE_SWAPCHAIN_IMAGE_RELEASE_INFO};
+        if (XR_FAILED(xrAcquireSwapchainImage(motionSwapchain.handle, &acquireInfo, &motionImageIndex))) {
+            return false;
+        }
+        if (XR_FAILED(xrWaitSwapchainImage(motionSwapchain.handle, &waitImageInfo))) {
+            xrReleaseSwapchainImage(motionSwapchain.handle, &releaseInfo);
+            return false;
+        }
+        if (XR_FAILED(xrAcquireSwapchainImage(depthSwapchain.handle, &acquireInfo, &depthImageIndex))) {
+            xrReleaseSwapchainImage(motionSwapchain.handle, &releaseInfo);
+            return false;
+        }
+        if (XR_FAILED(xrWaitSwapchainImage(depthSwapchain.handle, &waitImageInfo))) {
+            xrReleaseSwapchainImage(depthSwapchain.handle, &releaseInfo);
+            xrReleaseSwapchainImage(motionSwapchain.handle, &releaseInfo);
+            return false;
+        }
+
+        glBindFramebuffer(GL_FRAMEBUFFER, spaceWarpFramebuffer_);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
+                               motionSwapchain.images[motionImageIndex].image, 0);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D,
+                               depthSwapchain.images[depthImageIndex].image, 0);
+        glViewport(0, 0, motionSwapchain.width, motionSwapchain.height);
+        glDepthMask(GL_TRUE);
+        glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+        glClearDepthf(1.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+        xrReleaseSwapchainImage(depthSwapchain.handle, &releaseInfo);
+        xrReleaseSwapchainImage(motionSwapchain.handle, &releaseInfo);
+
+        spaceWarpInfo = {XR_TYPE_COMPOSITION_LAYER_SPACE_WARP_INFO_FB};
+        spaceWarpInfo.motionVectorSubImage.swapchain = motionSwapchain.handle;
+        spaceWarpInfo.motionVectorSubImage.imageRect.offset = {0, 0};
+        spaceWarpInfo.motionVectorSubImage.imageRect.extent = {motionSwapchain.width, motionSwapchain.height};
+        spaceWarpInfo.motionVectorSubImage.imageArrayIndex = 0;
+        spaceWarpInfo.appSpaceDeltaPose = {{0.0f, 0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, 0.0f}};
+        spaceWarpInfo.depthSubImage.swapchain = depthSwapchain.handle;
+        spaceWarpInfo.depthSubImage.imageRect.offset = {0, 0};
+        spaceWarpInfo.depthSubImage.imageRect.extent = {depthSwapchain.width, depthSwapchain.height};
+        spaceWarpInfo.depthSubImage.imageArrayIndex = 0;
+        spaceWarpInfo.minDepth = 0.0f;
+        spaceWarpInfo.maxDepth = 1.0f;
+        spaceWarpInfo.nearZ = kNearZ;
+        spaceWarpInfo.farZ = kFarZ;
+        return true;
+    }
+
+    // The SGSR program is built on the projectM context, which shares this driver, so one cache serves both
+    // contexts.
+    void InitializeProgramCache() {
+        bool enabled = true;
+        std::string cacheText;
+        if (ReadSystemProperty("debug.projectm.quest.perf.program_cache", cacheText)) {
+            ParseBoolText(cacheText, enabled);
+        }
+        GLint formatCount = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+        const std::string appDataPath(app_->activity->internalDataPath ? app_->activity->internalDataPath : "");
+        const std::string directory = appDataPath.empty() ? std::string() : (appDataPath + "/program_cache");
+        programCacheDirectory_ = enabled && formatCount > 0 && EnsureDirectory(directory) ? directory : std::string();
+        LOGI("Program binary cache: %s (%d binary formats)",
+             programCacheDirectory_.empty() ? "off" : programCacheDirectory_.c_str(),
+             formatCount);
+    }
+
+    // Links from the cached binary when one matches this driver and these sources; otherwise compiles from
+    // source and refreshes the cache entry. Either path returns 0 only if the sources themselves fail.
+    GLuint BuildProgram(const char* label, const char* vertexSource, const char* fragmentSource) {
+        const auto start = std::chrono::steady_clock::now();
+        const std::string cachePath =
+            programCacheDirectory_.empty() ? std::string() : (programCacheDirectory_ + "/" + label + ".bin");
+        const uint64_t key = cachePath.empty() ? 0 : ProgramBinaryKey(vertexSource, fragmentSource);
+        GLuint program = cachePath.empty() ? 0 : LoadProgramBinary(cachePath, key);
+        if (program != 0) {
+            ++programCacheHits_;
+        } else {
+            program = CompileAndLinkProgram(vertexSource, fragmentSource, !cachePath.empty());
+            if (program != 0 && !cachePath.empty()) {
+                ++programCacheMisses_;
+                if (!StoreProgramBinary(cachePath, key, program)) {
+                    LOGW("Could not cache program binary: %s", cachePath.c_str());
+                }
+            }
+        }
+        programBuildMicros_ += static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+        return program;
+    }
+
     bool InitializeScene() {
+        InitializeProgramCache();
         static const char* kVertexShaderSource = R"(
             #version 300 es
             precision highp float;
@@ -1626,7 +2985,12 @@ private:
             precision highp float;
             in vec3 vDirection;
             uniform sampler2D uProjectMTexture;
+            uniform sampler2D uProjectMPreviousTexture;
+            uniform sampler2D uProjectMSnapshotTexture;
+            uniform float uFrameBlend;
+            uniform float uSnapshotFade;
             uniform int uProjectionMode;
+            uniform int uCanvasMapping;
             out vec4 fragColor;
 
             const float PI = 3.14159265358979323846;
@@ -1643,27 +3007,28 @@ private:
 
                 // Place equirectangular seam on the rear hemisphere (behind the user).
                 float u = atan(dir.x, dir.z) / (2.0 * PI) + 0.5;
-                float v = asin(clamp(dir.y, -1.0, 1.0)) / PI + 0.5;
+                float sinLatitude = clamp(dir.y, -1.0, 1.0);
+                float v;
+                if (uCanvasMapping == 1) {
+                    v = sinLatitude * 0.5 + 0.5;
+                } else if (uCanvasMapping == 2) {
+                    v = 0.5 * (asin(sinLatitude) / PI + sinLatitude * 0.5) + 0.5;
+                } else {
+                    v = asin(sinLatitude) / PI + 0.5;
+                }
                 vec2 uv = vec2(u, 1.0 - v);
-                fragColor = texture(uProjectMTexture, uv);
+                vec4 color = texture(uProjectMTexture, uv);
+                if (uFrameBlend < 0.999) {
+                    color = mix(texture(uProjectMPreviousTexture, uv), color, uFrameBlend);
+                }
+                if (uSnapshotFade < 0.999) {
+                    color = mix(texture(uProjectMSnapshotTexture, uv), color, uSnapshotFade);
+                }
+                fragColor = color;
             }
         )";
 
-        const GLuint vs = CompileShader(GL_VERTEX_SHADER, kVertexShaderSource);
-        const GLuint fs = CompileShader(GL_FRAGMENT_SHADER, kFragmentShaderSource);
-        if (vs == 0 || fs == 0) {
-            if (vs != 0) {
-                glDeleteShader(vs);
-            }
-            if (fs != 0) {
-                glDeleteShader(fs);
-            }
-            return false;
-        }
-
-        sceneProgram_ = LinkProgram(vs, fs);
-        glDeleteShader(vs);
-        glDeleteShader(fs);
+        sceneProgram_ = BuildProgram("scene", kVertexShaderSource, kFragmentShaderSource);
         if (sceneProgram_ == 0) {
             return false;
         }
@@ -1671,6 +3036,11 @@ private:
         uViewProjectionLoc_ = glGetUniformLocation(sceneProgram_, "uViewProjection");
         uTextureLoc_ = glGetUniformLocation(sceneProgram_, "uProjectMTexture");
         uProjectionModeLoc_ = glGetUniformLocation(sceneProgram_, "uProjectionMode");
+        uPreviousTextureLoc_ = glGetUniformLocation(sceneProgram_, "uProjectMPreviousTexture");
+        uFrameBlendLoc_ = glGetUniformLocation(sceneProgram_, "uFrameBlend");
+        uSnapshotTextureLoc_ = glGetUniformLocation(sceneProgram_, "uProjectMSnapshotTexture");
+        uSnapshotFadeLoc_ = glGetUniformLocation(sceneProgram_, "uSnapshotFade");
+        uCanvasMappingLoc_ = glGetUniformLocation(sceneProgram_, "uCanvasMapping");
 
         BuildSphereMesh();
         if (sphereVao_ == 0 || sphereIndexCount_ == 0) {
@@ -1687,6 +3057,11 @@ private:
             projectionMode_ = ProjectionMode::FullSphere;
             LOGI("Projection mode: full sphere");
         }
+        std::string canvasMappingText;
+        if (ReadSystemProperty("debug.projectm.quest.canvas_mapping", canvasMappingText)) {
+            ParseCanvasMappingText(canvasMappingText, canvasMappingSetting_);
+        }
+        LOGI("Canvas mapping: %s", CanvasMappingLabel(canvasMappingSetting_));
 
         glDisable(GL_DEPTH_TEST);
         glDisable(GL_CULL_FACE);
@@ -1694,12 +3069,10 @@ private:
         if (!InitializeHudOverlay()) {
             return false;
         }
+        InitializeGpuPassTimers({&eyePassTimer_, &hudPassTimer_, &handsPassTimer_});
         if (!InitializeHandOverlay()) {
             LOGW("Failed to initialize hand overlay renderer.");
         }
-        if (!InitializeSgsrUpscaler()) {
-            LOGW("SGSR upscaler unavailable. Falling back to native projectM resolution.");
-        }
         return true;
     }
 
@@ -1709,9 +3082,10 @@ private:
             precision highp float;
             layout(location = 0) in vec2 aPosition;
             layout(location = 1) in vec2 aUv;
+            uniform highp vec4 SourceRect;
             layout(location = 0) out highp vec4 in_TEXCOORD0;
             void main() {
-                in_TEXCOORD0 = vec4(aUv, 0.0, 0.0);
+                in_TEXCOORD0 = vec4(aUv * SourceRect.xy, 0.0, 0.0);
                 gl_Position = vec4(aPosition, 0.0, 1.0);
             }
         )";
@@ -1726,6 +3100,9 @@ private:
             #define EdgeSharpness 2.0
 
             uniform highp vec4 ViewportInfo[1];
+            // xy: UV extent of the rendered region, zw: last texel inside it. The source target is allocated at the
+            // requested scale and projectM only fills its lower-left corner at lower adaptive scales.
+            uniform highp vec4 SourceRect;
             uniform mediump sampler2D ps0;
 
             layout(location = 0) in highp vec4 in_TEXCOORD0;
@@ -1759,7 +3136,7 @@ private:
                 if (mode != 4) {
                     highp vec2 imgCoord = (in_TEXCOORD0.xy * ViewportInfo[0].zw) + vec2(-0.5, 0.5);
                     highp vec2 imgCoordPixel = floor(imgCoord);
-                    highp vec2 coord = imgCoordPixel * ViewportInfo[0].xy;
+                    highp vec2 coord = min(imgCoordPixel * ViewportInfo[0].xy, SourceRect.zw);
                     vec2 pl = imgCoord - imgCoordPixel;
                     vec4 left = textureGather(ps0, coord, mode);
 
@@ -1767,12 +3144,12 @@ private:
                                      abs(color[mode] - left.y) +
                                      abs(color[mode] - left.z);
                     if (edgeVote > edgeThreshold) {
-                        coord.x += ViewportInfo[0].x;
+                        coord.x = min(coord.x + ViewportInfo[0].x, SourceRect.z);
 
-                        vec4 right = textureGather(ps0, coord + highp vec2(ViewportInfo[0].x, 0.0), mode);
+                        vec4 right = textureGather(ps0, min(coord + highp vec2(ViewportInfo[0].x, 0.0), SourceRect.zw), mode);
                         vec4 upDown;
                         upDown.xy = textureGather(ps0, coord + highp vec2(0.0, -ViewportInfo[0].y), mode).wz;
-                        upDown.zw = textureGather(ps0, coord + highp vec2(0.0, ViewportInfo[0].y), mode).yx;
+                        upDown.zw = textureGather(ps0, min(coord + highp vec2(0.0, ViewportInfo[0].y), SourceRect.zw), mode).yx;
 
                         float mean = (left.y + left.z + right.x + right.w) * 0.25;
                         left -= vec4(mean);
@@ -1817,28 +3194,15 @@ private:
             }
         )";
 
-        const GLuint vs = CompileShader(GL_VERTEX_SHADER, kUpscaleVertexShaderSource);
-        const GLuint fs = CompileShader(GL_FRAGMENT_SHADER, kUpscaleFragmentShaderSource);
-        if (vs == 0 || fs == 0) {
-            if (vs != 0) {
-                glDeleteShader(vs);
-            }
-            if (fs != 0) {
-                glDeleteShader(fs);
-            }
-            return false;
-        }
-
-        sgsrProgram_ = LinkProgram(vs, fs);
-        glDeleteShader(vs);
-        glDeleteShader(fs);
+        sgsrProgram_ = BuildProgram("sgsr", kUpscaleVertexShaderSource, kUpscaleFragmentShaderSource);
         if (sgsrProgram_ == 0) {
             return false;
         }
 
         sgsrViewportInfoLoc_ = glGetUniformLocation(sgsrProgram_, "ViewportInfo[0]");
         sgsrSamplerLoc_ = glGetUniformLocation(sgsrProgram_, "ps0");
-        if (sgsrViewportInfoLoc_ < 0 || sgsrSamplerLoc_ < 0) {
+        sgsrSourceRectLoc_ = glGetUniformLocation(sgsrProgram_, "SourceRect");
+        if (sgsrViewportInfoLoc_ < 0 || sgsrSamplerLoc_ < 0 || sgsrSourceRectLoc_ < 0) {
             LOGE("SGSR uniform locations missing.");
             glDeleteProgram(sgsrProgram_);
             sgsrProgram_ = 0;
@@ -1886,6 +3250,119 @@ private:
         return true;
     }
 
+    // Query objects are per-context, so each context initializes and destroys the timers it owns.
+    void InitializeGpuPassTimers(std::initializer_list<GpuPassTimer*> timers) {
+        const char* extensions = reinterpret_cast<const char*>(glGetString(GL_EXTENSIONS));
+        if (extensions == nullptr || std::strstr(extensions, "GL_EXT_disjoint_timer_query") == nullptr) {
+            LOGI("GL_EXT_disjoint_timer_query not available; per-pass GPU times disabled.");
+            return;
+        }
+        glGetQueryObjectui64vEXT_ = reinterpret_cast<PFNGLGETQUERYOBJECTUI64VEXTPROC>(
+            eglGetProcAddress("glGetQueryObjectui64vEXT"));
+        if (glGetQueryObjectui64vEXT_ == nullptr) {
+            LOGW("glGetQueryObjectui64vEXT missing; per-pass GPU times disabled.");
+            return;
+        }
+        for (GpuPassTimer* timer : timers) {
+            glGenQueries(static_cast<GLsizei>(timer->queries.size()), timer->queries.data());
+        }
+        LOGI("Per-pass GPU timers enabled (%zu).", timers.size());
+    }
+
+    void DestroyGpuPassTimers(std::initializer_list<GpuPassTimer*> timers) {
+        for (GpuPassTimer* timer : timers) {
+            if (timer->queries[0] != 0) {
+                glDeleteQueries(static_cast<GLsizei>(timer->queries.size()), timer->queries.data());
+            }
+            *timer = GpuPassTimer{};
+        }
+    }
+
+    void BeginGpuPassTimer(GpuPassTimer& timer) {
+        if (timer.queries[0] == 0) {
+            return;
+        }
+        CollectGpuPassTimer(timer);
+        if (timer.pending[timer.next]) {
+            return;
+        }
+        glBeginQuery(GL_TIME_ELAPSED_EXT, timer.queries[timer.next]);
+        timer.active = true;
+    }
+
+    void EndGpuPassTimer(GpuPassTimer& timer) {
+        if (!timer.active) {
+            return;
+        }
+        glEndQuery(GL_TIME_ELAPSED_EXT);
+        timer.active = false;
+        timer.pending[timer.next] = true;
+        timer.next = (timer.next + 1) % timer.queries.size();
+    }
+
+    void CollectGpuPassTimer(GpuPassTimer& timer) {
+        GLint disjoint = 0;
+        glGetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint);
+        for (size_t i = 0; i < timer.queries.size(); ++i) {
+            if (!timer.pending[i]) {
+                continue;
+            }
+            GLuint available = 0;
+            glGetQueryObjectuiv(timer.queries[i], GL_QUERY_RESULT_AVAILABLE, &available);
+            if (available == 0) {
+                continue;
+            }
+            timer.pending[i] = false;
+            if (timer.discardPending > 0) {
+                --timer.discardPending;
+                continue;
+            }
+            if (disjoint != 0) {
+                continue;
+            }
+            GLuint64 elapsedNs = 0;
+            glGetQueryObjectui64vEXT_(timer.queries[i], GL_QUERY_RESULT, &elapsedNs);
+            const double elapsedMs = static_cast<double>(elapsedNs) / 1.0e6;
+            timer.smoothedMs = timer.smoothedMs <= 0.0
+                                   ? elapsedMs
+                                   : timer.smoothedMs + (elapsedMs - timer.smoothedMs) * kGpuPassTimeSmoothing;
+            AddPassSample(timer.window, static_cast<float>(elapsedMs));
+        }
+    }
+
+    // Drops the rolling window after the measured workload changed (resize, preset load) so the stats only
+    // describe the new one.
+    void ResetGpuPassSamples(GpuPassTimer& timer) {
+        timer.window = PassSampleWindow{};
+        timer.discardPending = static_cast<size_t>(std::count(timer.pending.begin(), timer.pending.end(), true));
+    }
+
+    // Each context computes stats for the timers it owns and publishes them here at most every
+    // kGpuPassStatsPublishSeconds; the HUD, log and stats dump read the snapshot.
+    void PublishGpuPassStats(std::initializer_list<std::pair<GpuPass, const GpuPassTimer*>> timers,
+                             double& lastPublishSeconds,
+                             uint32_t renderPixels = 0) {
+        const double nowSeconds = ElapsedSeconds();
+        if (nowSeconds - lastPublishSeconds < kGpuPassStatsPublishSeconds) {
+            return;
+        }
+        lastPublishSeconds = nowSeconds;
+        std::array<GpuPassStats, kGpuPassCount> computed{};
+        for (const auto& entry : timers) {
+            computed[static_cast<size_t>(entry.first)] = ComputePassStats(entry.second->window);
+            computed[static_cast<size_t>(entry.first)].renderPixels = renderPixels;
+        }
+        std::lock_guard<std::mutex> lock(gpuPassStatsMutex_);
+        for (const auto& entry : timers) {
+            gpuPassStats_[static_cast<size_t>(entry.first)] = computed[static_cast<size_t>(entry.first)];
+        }
+    }
+
+    std::array<GpuPassStats, kGpuPassCount> SnapshotGpuPassStats() const {
+        std::lock_guard<std::mutex> lock(gpuPassStatsMutex_);
+        return gpuPassStats_;
+    }
+
     bool InitializeHudOverlay() {
         static const char* kHudVertexShaderSource = R"(
             #version 300 es
@@ -1900,33 +3377,22 @@ private:
             }
         )";
 
+        // Per-frame pass: the panel and buttons come from the baked chrome texture. A flash extrapolates the
+        // baked button away from the panel color, which matches raising that button's blend alpha.
         static const char* kHudFragmentShaderSource = R"(
             #version 300 es
             precision mediump float;
             in vec2 vUv;
-            uniform vec4 uFlashA;
-            uniform vec4 uFlashB;
-            uniform vec4 uFlashX;
-            uniform vec4 uFlashY;
-            uniform vec4 uFlashRT;
-            uniform vec4 uFlashLT;
-            uniform vec4 uFlashMenu;
+            uniform vec4 uButtonRects[7];
+            uniform float uButtonFlash[7];
+            uniform float uFlashActive;
+            uniform vec3 uPanelColor;
             uniform vec4 uPointerLeft;
             uniform vec4 uPointerRight;
             uniform sampler2D uTextTexture;
+            uniform sampler2D uChromeTexture;
             out vec4 fragColor;
 
-            float rectMask(vec2 uv, vec2 minPt, vec2 maxPt, float feather) {
-                vec2 inMin = smoothstep(minPt - vec2(feather), minPt + vec2(feather), uv);
-                vec2 inMax = smoothstep(maxPt + vec2(feather), maxPt - vec2(feather), uv);
-                return inMin.x * inMin.y * inMax.x * inMax.y;
-            }
-
-            vec3 blendRect(vec3 baseColor, vec2 uv, vec2 minPt, vec2 maxPt, vec3 color, float alpha) {
-                float m = rectMask(uv, minPt, maxPt, 0.0035);
-                return mix(baseColor, color, m * alpha);
-            }
-
             float pointerMask(vec2 uv, vec2 center, float radius, float feather) {
                 float dist = length(uv - center);
                 return smoothstep(radius + feather, radius - feather, dist);
@@ -1939,21 +3405,22 @@ private:
             }
 
             void main() {
-                vec3 color = vec3(0.0);
-                float alpha = rectMask(vUv, vec2(0.015, 0.02), vec2(0.985, 0.980), 0.0035) * 0.62;
+                vec4 chrome = texture(uChromeTexture, vUv);
+                float alpha = chrome.a;
                 if (alpha <= 0.001) {
                     discard;
                 }
-
-                color = vec3(0.08, 0.08, 0.10);
-
-                color = blendRect(color, vUv, vec2(0.07, 0.60), vec2(0.46, 0.82), vec3(0.14, 0.44, 0.87), 0.90 + uFlashX.x);
-                color = blendRect(color, vUv, vec2(0.54, 0.60), vec2(0.93, 0.82), vec3(0.93, 0.34, 0.26), 0.90 + uFlashA.x);
-                color = blendRect(color, vUv, vec2(0.07, 0.30), vec2(0.46, 0.52), vec3(0.18, 0.74, 0.38), 0.90 + uFlashY.x);
-                color = blendRect(color, vUv, vec2(0.54, 0.30), vec2(0.93, 0.52), vec3(0.91, 0.82, 0.28), 0.90 + uFlashB.x);
-                color = blendRect(color, vUv, vec2(0.07, 0.08), vec2(0.33, 0.24), vec3(0.58, 0.32, 0.86), 0.88 + uFlashLT.x);
-                color = blendRect(color, vUv, vec2(0.37, 0.08), vec2(0.63, 0.24), vec3(0.90, 0.54, 0.20), 0.88 + uFlashMenu.x);
-                color = blendRect(color, vUv, vec2(0.67, 0.08), vec2(0.93, 0.24), vec3(0.23, 0.72, 0.85), 0.88 + uFlashRT.x);
+                vec3 color = chrome.rgb;
+
+                if (uFlashActive > 0.5) {
+                    float flash = 0.0;
+                    for (int i = 0; i < 7; ++i) {
+                        vec4 r = uButtonRects[i];
+                        vec2 inside = step(r.xy, vUv) * step(vUv, r.zw);
+                        flash += uButtonFlash[i] * inside.x * inside.y;
+                    }
+                    color += (color - uPanelColor) * flash;
+                }
 
                 float textMask = texture(uTextTexture, vUv).r;
                 color = mix(color, vec3(0.97), clamp(textMask * 1.45, 0.0, 1.0));
@@ -1996,36 +3463,78 @@ private:
             }
         )";
 
-        const GLuint vs = CompileShader(GL_VERTEX_SHADER, kHudVertexShaderSource);
-        const GLuint fs = CompileShader(GL_FRAGMENT_SHADER, kHudFragmentShaderSource);
-        if (vs == 0 || fs == 0) {
-            if (vs != 0) {
-                glDeleteShader(vs);
+        // One-off bake of the feathered panel and button rects. Outside the panel the color stays at the panel
+        // color with zero alpha so bilinear filtering doesn't darken the edge.
+        static const char* kHudChromeFragmentShaderSource = R"(
+            #version 300 es
+            precision mediump float;
+            in vec2 vUv;
+            uniform vec4 uButtonRects[7];
+            uniform vec4 uButtonColors[7];
+            uniform vec3 uPanelColor;
+            out vec4 fragColor;
+
+            float rectMask(vec2 uv, vec2 minPt, vec2 maxPt, float feather) {
+                vec2 inMin = smoothstep(minPt - vec2(feather), minPt + vec2(feather), uv);
+                vec2 inMax = smoothstep(maxPt + vec2(feather), maxPt - vec2(feather), uv);
+                return inMin.x * inMin.y * inMax.x * inMax.y;
             }
-            if (fs != 0) {
-                glDeleteShader(fs);
+
+            void main() {
+                float alpha = rectMask(vUv, vec2(0.015, 0.02), vec2(0.985, 0.980), 0.0035) * 0.62;
+                vec3 color = uPanelColor;
+                for (int i = 0; i < 7; ++i) {
+                    float m = rectMask(vUv, uButtonRects[i].xy, uButtonRects[i].zw, 0.0035);
+                    color = mix(color, uButtonColors[i].rgb, m * uButtonColors[i].a);
+                }
+                fragColor = vec4(color, alpha);
             }
-            return false;
-        }
+        )";
 
-        hudProgram_ = LinkProgram(vs, fs);
-        glDeleteShader(vs);
-        glDeleteShader(fs);
+        hudProgram_ = BuildProgram("hud", kHudVertexShaderSource, kHudFragmentShaderSource);
         if (hudProgram_ == 0) {
             return false;
         }
+        hudChromeProgram_ = BuildProgram("hud_chrome", kHudVertexShaderSource, kHudChromeFragmentShaderSource);
+        if (hudChromeProgram_ == 0) {
+            return false;
+        }
+
+        std::array<float, kHudChromeButtons.size() * 4> buttonRects{};
+        std::array<float, kHudChromeButtons.size() * 4> buttonColors{};
+        for (size_t i = 0; i < kHudChromeButtons.size(); ++i) {
+            const HudChromeButton& button = kHudChromeButtons[i];
+            buttonRects[i * 4 + 0] = button.rect.minU;
+            buttonRects[i * 4 + 1] = button.rect.minV;
+            buttonRects[i * 4 + 2] = button.rect.maxU;
+            buttonRects[i * 4 + 3] = button.rect.maxV;
+            buttonColors[i * 4 + 0] = button.r;
+            buttonColors[i * 4 + 1] = button.g;
+            buttonColors[i * 4 + 2] = button.b;
+            buttonColors[i * 4 + 3] = button.baseAlpha;
+        }
+        const GLsizei buttonCount = static_cast<GLsizei>(kHudChromeButtons.size());
+
+        glUseProgram(hudChromeProgram_);
+        glUniformMatrix4fv(glGetUniformLocation(hudChromeProgram_, "uHudMvp"), 1, GL_FALSE,
+                           glm::value_ptr(glm::scale(glm::mat4(1.0f), glm::vec3(2.0f, 2.0f, 1.0f))));
+        glUniform4fv(glGetUniformLocation(hudChromeProgram_, "uButtonRects"), buttonCount, buttonRects.data());
+        glUniform4fv(glGetUniformLocation(hudChromeProgram_, "uButtonColors"), buttonCount, buttonColors.data());
+        glUniform3fv(glGetUniformLocation(hudChromeProgram_, "uPanelColor"), 1, kHudPanelColor);
 
         hudMvpLoc_ = glGetUniformLocation(hudProgram_, "uHudMvp");
-        hudFlashALoc_ = glGetUniformLocation(hudProgram_, "uFlashA");
-        hudFlashBLoc_ = glGetUniformLocation(hudProgram_, "uFlashB");
-        hudFlashXLoc_ = glGetUniformLocation(hudProgram_, "uFlashX");
-        hudFlashYLoc_ = glGetUniformLocation(hudProgram_, "uFlashY");
-        hudFlashRtLoc_ = glGetUniformLocation(hudProgram_, "uFlashRT");
-        hudFlashLtLoc_ = glGetUniformLocation(hudProgram_, "uFlashLT");
-        hudFlashMenuLoc_ = glGetUniformLocation(hudProgram_, "uFlashMenu");
+        hudButtonFlashLoc_ = glGetUniformLocation(hudProgram_, "uButtonFlash");
+        hudFlashActiveLoc_ = glGetUniformLocation(hudProgram_, "uFlashActive");
         hudPointerLeftLoc_ = glGetUniformLocation(hudProgram_, "uPointerLeft");
         hudPointerRightLoc_ = glGetUniformLocation(hudProgram_, "uPointerRight");
         hudTextSamplerLoc_ = glGetUniformLocation(hudProgram_, "uTextTexture");
+        hudChromeSamplerLoc_ = glGetUniformLocation(hudProgram_, "uChromeTexture");
+
+        // Button rects and panel color are layout constants; only the flash amounts change per frame.
+        glUseProgram(hudProgram_);
+        glUniform4fv(glGetUniformLocation(hudProgram_, "uButtonRects"), buttonCount, buttonRects.data());
+        glUniform3fv(glGetUniformLocation(hudProgram_, "uPanelColor"), 1, kHudPanelColor);
+        glUseProgram(0);
 
         const float hudVertices[] = {
             -0.5f, -0.5f, 0.0f, 0.0f,
@@ -2065,7 +3574,40 @@ private:
                      GL_UNSIGNED_BYTE,
                      hudTextPixels_.data());
         glBindTexture(GL_TEXTURE_2D, 0);
-        hudTextDirty_ = true;
+        hudTextLabels_ = {};
+
+        glGenTextures(1, &hudChromeTexture_);
+        glGenFramebuffers(1, &hudChromeFramebuffer_);
+        if (hudChromeTexture_ == 0 || hudChromeFramebuffer_ == 0) {
+            return false;
+        }
+        glBindTexture(GL_TEXTURE_2D, hudChromeTexture_);
+        glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, kHudChromeTextureWidth, kHudChromeTextureHeight);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        glBindFramebuffer(GL_FRAMEBUFFER, hudChromeFramebuffer_);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, hudChromeTexture_, 0);
+        const GLenum chromeStatus = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        if (chromeStatus != GL_FRAMEBUFFER_COMPLETE) {
+            LOGE("HUD chrome framebuffer incomplete: 0x%x", chromeStatus);
+            return false;
+        }
+        hudChromeDirty_ = true;
+
+        for (HudTextPbo& pbo : hudTextPbos_) {
+            glGenBuffers(1, &pbo.buffer);
+            if (pbo.buffer == 0) {
+                return false;
+            }
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo.buffer);
+            glBufferData(GL_PIXEL_UNPACK_BUFFER, static_cast<GLsizeiptr>(kHudTextPboBytes), nullptr, GL_STREAM_DRAW);
+        }
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        StartHudTextThread();
 
         return true;
     }
@@ -2075,47 +3617,34 @@ private:
             #version 300 es
             precision highp float;
             layout(location = 0) in vec3 aPosition;
+            layout(location = 1) in vec4 aColor;
+            layout(location = 2) in float aPointSize;
             uniform mat4 uViewProjection;
-            uniform float uPointSize;
+            out vec4 vColor;
             void main() {
                 gl_Position = uViewProjection * vec4(aPosition, 1.0);
-                gl_PointSize = uPointSize;
+                gl_PointSize = aPointSize;
+                vColor = aColor;
             }
         )";
 
         static const char* kHandFragmentShaderSource = R"(
             #version 300 es
             precision mediump float;
-            uniform vec4 uColor;
+            in vec4 vColor;
             out vec4 fragColor;
             void main() {
-                fragColor = uColor;
+                fragColor = vColor;
             }
         )";
 
-        const GLuint vs = CompileShader(GL_VERTEX_SHADER, kHandVertexShaderSource);
-        const GLuint fs = CompileShader(GL_FRAGMENT_SHADER, kHandFragmentShaderSource);
-        if (vs == 0 || fs == 0) {
-            if (vs != 0) {
-                glDeleteShader(vs);
-            }
-            if (fs != 0) {
-                glDeleteShader(fs);
-            }
-            return false;
-        }
-
-        handProgram_ = LinkProgram(vs, fs);
-        glDeleteShader(vs);
-        glDeleteShader(fs);
+        handProgram_ = BuildProgram("hand", kHandVertexShaderSource, kHandFragmentShaderSource);
         if (handProgram_ == 0) {
             return false;
         }
 
         handViewProjectionLoc_ = glGetUniformLocation(handProgram_, "uViewProjection");
-        handColorLoc_ = glGetUniformLocation(handProgram_, "uColor");
-        handPointSizeLoc_ = glGetUniformLocation(handProgram_, "uPointSize");
-        if (handViewProjectionLoc_ < 0 || handColorLoc_ < 0 || handPointSizeLoc_ < 0) {
+        if (handViewProjectionLoc_ < 0) {
             return false;
         }
 
@@ -2127,9 +3656,20 @@ private:
 
         glBindVertexArray(handVao_);
         glBindBuffer(GL_ARRAY_BUFFER, handVbo_);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(glm::vec3) * XR_HAND_JOINT_COUNT_EXT * 2, nullptr, GL_DYNAMIC_DRAW);
+        // Sized for both hands at full joint count; each frame orphans the storage and fills a sub-range.
+        glBufferData(GL_ARRAY_BUFFER,
+                     static_cast<GLsizeiptr>(handOverlayVertices_.size() * sizeof(HandOverlayVertex)),
+                     nullptr,
+                     GL_STREAM_DRAW);
         glEnableVertexAttribArray(0);
-        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(glm::vec3), nullptr);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(HandOverlayVertex),
+                              reinterpret_cast<const void*>(offsetof(HandOverlayVertex, position)));
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(HandOverlayVertex),
+                              reinterpret_cast<const void*>(offsetof(HandOverlayVertex, color)));
+        glEnableVertexAttribArray(2);
+        glVertexAttribPointer(2, 1, GL_FLOAT, GL_FALSE, sizeof(HandOverlayVertex),
+                              reinterpret_cast<const void*>(offsetof(HandOverlayVertex, pointSize)));
         glBindVertexArray(0);
         return true;
     }
@@ -2145,49 +3685,411 @@ private:
                 xrGetInstanceProcAddr(xrInstance_, procName, procOut)) && *procOut != nullptr;
         };
 
-        PFN_xrVoidFunction createProc = nullptr;
-        PFN_xrVoidFunction destroyProc = nullptr;
-        PFN_xrVoidFunction locateProc = nullptr;
-        if (!loadProc("xrCreateHandTrackerEXT", &createProc) ||
-            !loadProc("xrDestroyHandTrackerEXT", &destroyProc) ||
-            !loadProc("xrLocateHandJointsEXT", &locateProc)) {
-            LOGW("Failed to load XR_EXT_hand_tracking function pointers.");
+        PFN_xrVoidFunction createProc = nullptr;
+        PFN_xrVoidFunction destroyProc = nullptr;
+        PFN_xrVoidFunction locateProc = nullptr;
+        if (!loadProc("xrCreateHandTrackerEXT", &createProc) ||
+            !loadProc("xrDestroyHandTrackerEXT", &destroyProc) ||
+            !loadProc("xrLocateHandJointsEXT", &locateProc)) {
+            LOGW("Failed to load XR_EXT_hand_tracking function pointers.");
+            return false;
+        }
+
+        xrCreateHandTrackerEXT_ = reinterpret_cast<PFN_xrCreateHandTrackerEXT>(createProc);
+        xrDestroyHandTrackerEXT_ = reinterpret_cast<PFN_xrDestroyHandTrackerEXT>(destroyProc);
+        xrLocateHandJointsEXT_ = reinterpret_cast<PFN_xrLocateHandJointsEXT>(locateProc);
+
+        XrHandTrackerCreateInfoEXT createInfo{XR_TYPE_HAND_TRACKER_CREATE_INFO_EXT};
+        createInfo.handJointSet = XR_HAND_JOINT_SET_DEFAULT_EXT;
+
+        createInfo.hand = XR_HAND_LEFT_EXT;
+        if (XR_FAILED(xrCreateHandTrackerEXT_(xrSession_, &createInfo, &leftHandTracker_))) {
+            leftHandTracker_ = XR_NULL_HANDLE;
+            LOGW("xrCreateHandTrackerEXT failed for left hand.");
+            return false;
+        }
+
+        createInfo.hand = XR_HAND_RIGHT_EXT;
+        if (XR_FAILED(xrCreateHandTrackerEXT_(xrSession_, &createInfo, &rightHandTracker_))) {
+            if (leftHandTracker_ != XR_NULL_HANDLE) {
+                xrDestroyHandTrackerEXT_(leftHandTracker_);
+                leftHandTracker_ = XR_NULL_HANDLE;
+            }
+            rightHandTracker_ = XR_NULL_HANDLE;
+            LOGW("xrCreateHandTrackerEXT failed for right hand.");
+            return false;
+        }
+
+        handTrackingReady_ = true;
+        LOGI("OpenXR hand trackers initialized.");
+        return true;
+    }
+
+    bool InitializeFoveation() {
+        if (!foveationExtensionEnabled_) {
+            return false;
+        }
+
+        auto loadProc = [&](const char* procName, PFN_xrVoidFunction* procOut) -> bool {
+            *procOut = nullptr;
+            return XR_SUCCEEDED(
+                xrGetInstanceProcAddr(xrInstance_, procName, procOut)) && *procOut != nullptr;
+        };
+
+        PFN_xrVoidFunction createProc = nullptr;
+        PFN_xrVoidFunction destroyProc = nullptr;
+        PFN_xrVoidFunction updateProc = nullptr;
+        if (!loadProc("xrCreateFoveationProfileFB", &createProc) ||
+            !loadProc("xrDestroyFoveationProfileFB", &destroyProc) ||
+            !loadProc("xrUpdateSwapchainFB", &updateProc)) {
+            LOGW("Failed to load XR_FB_foveation function pointers.");
+            return false;
+        }
+
+        xrCreateFoveationProfileFB_ = reinterpret_cast<PFN_xrCreateFoveationProfileFB>(createProc);
+        xrDestroyFoveationProfileFB_ = reinterpret_cast<PFN_xrDestroyFoveationProfileFB>(destroyProc);
+        xrUpdateSwapchainFB_ = reinterpret_cast<PFN_xrUpdateSwapchainFB>(updateProc);
+        foveationReady_ = true;
+
+        if (!ApplyFoveationProfileIfNeeded(true)) {
+            foveationReady_ = false;
+            return false;
+        }
+        LOGI("OpenXR foveation initialized.");
+        return true;
+    }
+
+    bool InitializePerformanceSettings() {
+        if (!performanceSettingsExtensionEnabled_) {
+            return false;
+        }
+
+        PFN_xrVoidFunction setLevelProc = nullptr;
+        if (XR_FAILED(xrGetInstanceProcAddr(xrInstance_, "xrPerfSettingsSetPerformanceLevelEXT", &setLevelProc)) ||
+            setLevelProc == nullptr) {
+            LOGW("Failed to load xrPerfSettingsSetPerformanceLevelEXT.");
+            return false;
+        }
+
+        xrPerfSettingsSetPerformanceLevelEXT_ =
+            reinterpret_cast<PFN_xrPerfSettingsSetPerformanceLevelEXT>(setLevelProc);
+        performanceSettingsReady_ = true;
+        LOGI("OpenXR performance settings initialized.");
+        return true;
+    }
+
+    static const char* PerfSettingsLevelLabel(XrPerfSettingsLevelEXT level) {
+        switch (level) {
+            case XR_PERF_SETTINGS_LEVEL_POWER_SAVINGS_EXT: return "power-savings";
+            case XR_PERF_SETTINGS_LEVEL_SUSTAINED_LOW_EXT: return "sustained-low";
+            case XR_PERF_SETTINGS_LEVEL_SUSTAINED_HIGH_EXT: return "sustained-high";
+            case XR_PERF_SETTINGS_LEVEL_BOOST_EXT: return "boost";
+            default: return "?";
+        }
+    }
+
+    void SetPerformanceLevel(XrPerfSettingsDomainEXT domain, XrPerfSettingsLevelEXT level) {
+        const size_t slot = domain == XR_PERF_SETTINGS_DOMAIN_CPU_EXT ? 0 : 1;
+        if (appliedPerfLevelValid_[slot] && appliedPerfLevels_[slot] == level) {
+            return;
+        }
+        if (XR_FAILED(xrPerfSettingsSetPerformanceLevelEXT_(xrSession_, domain, level))) {
+            LOGW("xrPerfSettingsSetPerformanceLevelEXT(%s, %s) failed.",
+                 slot == 0 ? "CPU" : "GPU",
+                 PerfSettingsLevelLabel(level));
+            return;
+        }
+        appliedPerfLevels_[slot] = level;
+        appliedPerfLevelValid_[slot] = true;
+        LOGI("Performance level %s -> %s", slot == 0 ? "CPU" : "GPU", PerfSettingsLevelLabel(level));
+    }
+
+    void UpdatePerformanceHints(double nowSeconds, bool idle) {
+        if (!performanceSettingsReady_ || xrSession_ == XR_NULL_HANDLE) {
+            return;
+        }
+
+        XrPerfSettingsLevelEXT cpuLevel = XR_PERF_SETTINGS_LEVEL_SUSTAINED_HIGH_EXT;
+        XrPerfSettingsLevelEXT gpuLevel = XR_PERF_SETTINGS_LEVEL_SUSTAINED_HIGH_EXT;
+        if (idle) {
+            cpuLevel = XR_PERF_SETTINGS_LEVEL_POWER_SAVINGS_EXT;
+            gpuLevel = XR_PERF_SETTINGS_LEVEL_POWER_SAVINGS_EXT;
+        } else if (nowSeconds < perfBoostUntilSeconds_) {
+            cpuLevel = XR_PERF_SETTINGS_LEVEL_BOOST_EXT;
+            gpuLevel = XR_PERF_SETTINGS_LEVEL_BOOST_EXT;
+        }
+        SetPerformanceLevel(XR_PERF_SETTINGS_DOMAIN_CPU_EXT, cpuLevel);
+        SetPerformanceLevel(XR_PERF_SETTINGS_DOMAIN_GPU_EXT, gpuLevel);
+    }
+
+    // Boost is short-lived by design; callers request it right before a known spike (preset compile,
+    // render-target reallocation, asset copy) and the per-frame hint update drops back afterwards.
+    void RequestPerformanceBoost(double seconds) {
+        const double nowSeconds = ElapsedSeconds();
+        perfBoostUntilSeconds_ = std::max(perfBoostUntilSeconds_, nowSeconds + seconds);
+        UpdatePerformanceHints(nowSeconds, false);
+    }
+
+    void HandlePerfSettingsNotification(XrPerfSettingsDomainEXT domain,
+                                        XrPerfSettingsSubDomainEXT subDomain,
+                                        XrPerfSettingsNotificationLevelEXT fromLevel,
+                                        XrPerfSettingsNotificationLevelEXT toLevel) {
+        const char* subDomainLabel = subDomain == XR_PERF_SETTINGS_SUB_DOMAIN_COMPOSITING_EXT
+            ? "compositing"
+            : (subDomain == XR_PERF_SETTINGS_SUB_DOMAIN_RENDERING_EXT ? "rendering" : "thermal");
+        size_t subDomainSlot = 2;
+        if (subDomain == XR_PERF_SETTINGS_SUB_DOMAIN_COMPOSITING_EXT) {
+            subDomainSlot = 0;
+        } else if (subDomain == XR_PERF_SETTINGS_SUB_DOMAIN_RENDERING_EXT) {
+            subDomainSlot = 1;
+        }
+        const size_t domainSlot = domain == XR_PERF_SETTINGS_DOMAIN_CPU_EXT ? 0 : 1;
+        perfNotificationLevels_[domainSlot][subDomainSlot] = toLevel;
+
+        runtimePerfNotificationLevel_ = XR_PERF_SETTINGS_NOTIF_LEVEL_NORMAL_EXT;
+        for (const auto& domainLevels : perfNotificationLevels_) {
+            for (const auto level : domainLevels) {
+                runtimePerfNotificationLevel_ = std::max(runtimePerfNotificationLevel_, level);
+            }
+        }
+
+        if (toLevel == XR_PERF_SETTINGS_NOTIF_LEVEL_NORMAL_EXT) {
+            LOGI("Runtime perf notification: %s/%s %d -> %d",
+                 domainSlot == 0 ? "CPU" : "GPU",
+                 subDomainLabel,
+                 static_cast<int>(fromLevel),
+                 static_cast<int>(toLevel));
+        } else {
+            LOGW("Runtime perf notification: %s/%s %d -> %d",
+                 domainSlot == 0 ? "CPU" : "GPU",
+                 subDomainLabel,
+                 static_cast<int>(fromLevel),
+                 static_cast<int>(toLevel));
+            const double nowSeconds = ElapsedSeconds();
+            SetHudInputFeedback(nowSeconds,
+                                toLevel == XR_PERF_SETTINGS_NOTIF_LEVEL_IMPAIRED_EXT
+                                    ? "RUNTIME PERF IMPAIRED"
+                                    : "RUNTIME PERF WARNING");
+        }
+    }
+
+    bool InitializeDisplayRefreshRate() {
+        if (!displayRefreshRateExtensionEnabled_) {
+            return false;
+        }
+
+        auto loadProc = [&](const char* procName, PFN_xrVoidFunction* procOut) -> bool {
+            *procOut = nullptr;
+            return XR_SUCCEEDED(
+                xrGetInstanceProcAddr(xrInstance_, procName, procOut)) && *procOut != nullptr;
+        };
+
+        PFN_xrVoidFunction enumerateProc = nullptr;
+        PFN_xrVoidFunction getProc = nullptr;
+        PFN_xrVoidFunction requestProc = nullptr;
+        if (!loadProc("xrEnumerateDisplayRefreshRatesFB", &enumerateProc) ||
+            !loadProc("xrGetDisplayRefreshRateFB", &getProc) ||
+            !loadProc("xrRequestDisplayRefreshRateFB", &requestProc)) {
+            LOGW("Failed to load XR_FB_display_refresh_rate function pointers.");
+            return false;
+        }
+
+        xrEnumerateDisplayRefreshRatesFB_ = reinterpret_cast<PFN_xrEnumerateDisplayRefreshRatesFB>(enumerateProc);
+        xrGetDisplayRefreshRateFB_ = reinterpret_cast<PFN_xrGetDisplayRefreshRateFB>(getProc);
+        xrRequestDisplayRefreshRateFB_ = reinterpret_cast<PFN_xrRequestDisplayRefreshRateFB>(requestProc);
+
+        uint32_t rateCount = 0;
+        if (XR_FAILED(xrEnumerateDisplayRefreshRatesFB_(xrSession_, 0, &rateCount, nullptr)) || rateCount == 0) {
+            LOGW("xrEnumerateDisplayRefreshRatesFB count failed.");
+            return false;
+        }
+        supportedDisplayRefreshRates_.resize(rateCount);
+        if (XR_FAILED(xrEnumerateDisplayRefreshRatesFB_(
+                xrSession_, rateCount, &rateCount, supportedDisplayRefreshRates_.data()))) {
+            LOGW("xrEnumerateDisplayRefreshRatesFB list failed.");
+            supportedDisplayRefreshRates_.clear();
+            return false;
+        }
+        supportedDisplayRefreshRates_.resize(rateCount);
+        std::sort(supportedDisplayRefreshRates_.begin(), supportedDisplayRefreshRates_.end());
+
+        float currentRate = 0.0f;
+        if (XR_SUCCEEDED(xrGetDisplayRefreshRateFB_(xrSession_, &currentRate)) && currentRate > 1.0f) {
+            activeDisplayRefreshRate_ = currentRate;
+        }
+        runtimeDefaultDisplayRefreshRate_ = activeDisplayRefreshRate_;
+        displayRefreshRateReady_ = true;
+
+        std::string ratesText;
+        for (const float rate : supportedDisplayRefreshRates_) {
+            char rateText[16] = {};
+            std::snprintf(rateText, sizeof(rateText), ratesText.empty() ? "%.0f" : " %.0f", static_cast<double>(rate));
+            ratesText += rateText;
+        }
+        LOGI("Display refresh rates: [%s] active=%.0f Hz",
+             ratesText.c_str(),
+             static_cast<double>(activeDisplayRefreshRate_));
+        return true;
+    }
+
+    // Highest supported rate at or below the preference (0 means the runtime default).
+    int SupportedRefreshRateIndex(float preferredRate) const {
+        const float preferred = preferredRate > 1.0f ? preferredRate : runtimeDefaultDisplayRefreshRate_;
+        int index = 0;
+        for (size_t i = 0; i < supportedDisplayRefreshRates_.size(); ++i) {
+            if (supportedDisplayRefreshRates_[i] <= preferred + 0.5f) {
+                index = static_cast<int>(i);
+            }
+        }
+        return index;
+    }
+
+    float TargetDisplayRefreshRate() const {
+        if (supportedDisplayRefreshRates_.empty()) {
+            return activeDisplayRefreshRate_;
+        }
+
+        int index = SupportedRefreshRateIndex(preferredDisplayRefreshRate_);
+
+        // Governor drops walk down the supported list but never below the comfort floor.
+        for (int step = 0; step < refreshRateDropSteps_ && index > 0; ++step) {
+            if (supportedDisplayRefreshRates_[static_cast<size_t>(index - 1)] < kMinAutoDisplayRefreshRate - 0.5f) {
+                break;
+            }
+            --index;
+        }
+        return supportedDisplayRefreshRates_[static_cast<size_t>(index)];
+    }
+
+    bool CanDropDisplayRefreshRate() const {
+        if (!displayRefreshRateReady_) {
+            return false;
+        }
+        const float target = TargetDisplayRefreshRate();
+        for (const float rate : supportedDisplayRefreshRates_) {
+            if (rate < target - 0.5f && rate >= kMinAutoDisplayRefreshRate - 0.5f) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void ApplyDisplayRefreshRateIfNeeded() {
+        if (!displayRefreshRateReady_ || xrSession_ == XR_NULL_HANDLE) {
+            return;
+        }
+
+        const float target = TargetDisplayRefreshRate();
+        if (std::fabs(target - requestedDisplayRefreshRate_) < 0.5f) {
+            return;
+        }
+        if (XR_FAILED(xrRequestDisplayRefreshRateFB_(xrSession_, target))) {
+            LOGW("xrRequestDisplayRefreshRateFB(%.0f) failed.", static_cast<double>(target));
+            requestedDisplayRefreshRate_ = target;
+            return;
+        }
+        requestedDisplayRefreshRate_ = target;
+        LOGI("Requested display refresh rate %.0f Hz (preferred=%.0f drops=%d)",
+             static_cast<double>(target),
+             static_cast<double>(preferredDisplayRefreshRate_),
+             refreshRateDropSteps_);
+    }
+
+    float FpsThresholdScale() const {
+        const float spaceWarpScale = spaceWarpSubmitting_ ? 0.5f : 1.0f;
+        return std::max(activeDisplayRefreshRate_, 1.0f) * spaceWarpScale / kReferenceDisplayRefreshRate;
+    }
+
+    bool ShouldSubmitSpaceWarp(double nowSeconds) const {
+        if (!spaceWarpReady_ || spaceWarpMode_ == SpaceWarpMode::Off) {
+            return false;
+        }
+        if (spaceWarpMode_ == SpaceWarpMode::Auto && !spaceWarpEngaged_) {
+            return false;
+        }
+        // The HUD is head-locked; synthesized frames would reproject it as world-fixed, so keep full rate while
+        // it is on screen.
+        return !(hudEnabled_ && nowSeconds <= hudVisibleUntilSeconds_);
+    }
+
+    void SetSpaceWarpSubmitting(double nowSeconds, bool submitting) {
+        if (spaceWarpSubmitting_ == submitting) {
+            return;
+        }
+        spaceWarpSubmitting_ = submitting;
+        // The frame rate is about to halve or double; restart hold timers so the transition isn't read as load.
+        lowFpsForAutoScaleSinceSeconds_ = -1.0;
+        highFpsForAutoScaleSinceSeconds_ = -1.0;
+        lowFpsSinceSeconds_ = -1.0;
+        lastAutoScaleAdjustSeconds_ = nowSeconds;
+        LOGI("SpaceWarp %s", submitting ? "active (half-rate rendering)" : "inactive (full-rate rendering)");
+    }
+
+    FoveationLevel EffectiveFoveationLevel() const {
+        const int level = static_cast<int>(foveationLevel_) + foveationAutoBoost_;
+        return static_cast<FoveationLevel>(std::clamp(level,
+                                                      static_cast<int>(FoveationLevel::Off),
+                                                      static_cast<int>(FoveationLevel::High)));
+    }
+
+    bool ApplyFoveationProfileIfNeeded(bool force = false) {
+        if (!foveationReady_ || xrSession_ == XR_NULL_HANDLE) {
             return false;
         }
 
-        xrCreateHandTrackerEXT_ = reinterpret_cast<PFN_xrCreateHandTrackerEXT>(createProc);
-        xrDestroyHandTrackerEXT_ = reinterpret_cast<PFN_xrDestroyHandTrackerEXT>(destroyProc);
-        xrLocateHandJointsEXT_ = reinterpret_cast<PFN_xrLocateHandJointsEXT>(locateProc);
+        const FoveationLevel level = EffectiveFoveationLevel();
+        if (!force && level == appliedFoveationLevel_ && foveationDynamic_ == appliedFoveationDynamic_) {
+            return true;
+        }
 
-        XrHandTrackerCreateInfoEXT createInfo{XR_TYPE_HAND_TRACKER_CREATE_INFO_EXT};
-        createInfo.handJointSet = XR_HAND_JOINT_SET_DEFAULT_EXT;
+        XrFoveationLevelProfileCreateInfoFB levelInfo{XR_TYPE_FOVEATION_LEVEL_PROFILE_CREATE_INFO_FB};
+        levelInfo.level = static_cast<XrFoveationLevelFB>(static_cast<int>(level));
+        levelInfo.verticalOffset = 0.0f;
+        levelInfo.dynamic = foveationDynamic_ && level != FoveationLevel::Off
+            ? XR_FOVEATION_DYNAMIC_LEVEL_ENABLED_FB
+            : XR_FOVEATION_DYNAMIC_DISABLED_FB;
 
-        createInfo.hand = XR_HAND_LEFT_EXT;
-        if (XR_FAILED(xrCreateHandTrackerEXT_(xrSession_, &createInfo, &leftHandTracker_))) {
-            leftHandTracker_ = XR_NULL_HANDLE;
-            LOGW("xrCreateHandTrackerEXT failed for left hand.");
+        XrFoveationProfileCreateInfoFB profileInfo{XR_TYPE_FOVEATION_PROFILE_CREATE_INFO_FB};
+        profileInfo.next = &levelInfo;
+
+        XrFoveationProfileFB profile = XR_NULL_HANDLE;
+        if (XR_FAILED(xrCreateFoveationProfileFB_(xrSession_, &profileInfo, &profile))) {
+            LOGW("xrCreateFoveationProfileFB failed for level %s.", FoveationLevelLabel(level));
             return false;
         }
 
-        createInfo.hand = XR_HAND_RIGHT_EXT;
-        if (XR_FAILED(xrCreateHandTrackerEXT_(xrSession_, &createInfo, &rightHandTracker_))) {
-            if (leftHandTracker_ != XR_NULL_HANDLE) {
-                xrDestroyHandTrackerEXT_(leftHandTracker_);
-                leftHandTracker_ = XR_NULL_HANDLE;
+        bool updatedAll = true;
+        for (const auto& swapchain : swapchains_) {
+            XrSwapchainStateFoveationFB foveationState{XR_TYPE_SWAPCHAIN_STATE_FOVEATION_FB};
+            foveationState.profile = profile;
+            if (XR_FAILED(xrUpdateSwapchainFB_(
+                    swapchain.handle, reinterpret_cast<const XrSwapchainStateBaseHeaderFB*>(&foveationState)))) {
+                updatedAll = false;
             }
-            rightHandTracker_ = XR_NULL_HANDLE;
-            LOGW("xrCreateHandTrackerEXT failed for right hand.");
+        }
+
+        // The runtime copies the profile into the swapchain state, so it can be released right away.
+        xrDestroyFoveationProfileFB_(profile);
+        if (!updatedAll) {
+            LOGW("xrUpdateSwapchainFB failed to apply foveation level %s.", FoveationLevelLabel(level));
             return false;
         }
 
-        handTrackingReady_ = true;
-        LOGI("OpenXR hand trackers initialized.");
+        appliedFoveationLevel_ = level;
+        appliedFoveationDynamic_ = foveationDynamic_;
+        LOGI("Foveation applied: level=%s dynamic=%d (base=%s autoBoost=%d)",
+             FoveationLevelLabel(level),
+             appliedFoveationDynamic_ ? 1 : 0,
+             FoveationLevelLabel(foveationLevel_),
+             foveationAutoBoost_);
         return true;
     }
 
     void ClearHandJointRenderState() {
         leftHandJointRender_ = {};
         rightHandJointRender_ = {};
+        handOverlayLineVertexCount_ = 0;
+        handOverlayPointVertexCount_ = 0;
     }
 
     void UpdateHandJointRenderState(XrTime displayTime) {
@@ -2234,31 +4136,35 @@ private:
         locateHand(rightHandTracker_, rightHandJointRender_);
     }
 
-    void RenderHandJoints(const glm::mat4& viewProjection) {
-        if (handProgram_ == 0 || handVao_ == 0 || handVbo_ == 0) {
+    // Packs both hands into handOverlayVertices_ and uploads them once; every eye then reuses the buffer. The
+    // counts are cleared up front so any early return (no hands, nothing tracked) draws nothing.
+    void BuildHandJointGeometry() {
+        handOverlayLineVertexCount_ = 0;
+        handOverlayPointVertexCount_ = 0;
+        if (handProgram_ == 0 || handVbo_ == 0 || !handTrackingReady_) {
             return;
         }
-        if (!handTrackingReady_) {
+        if (!leftHandJointRender_.isActive && !rightHandJointRender_.isActive) {
             return;
         }
 
-        glEnable(GL_BLEND);
-        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-        glDisable(GL_DEPTH_TEST);
-        glUseProgram(handProgram_);
-        glUniformMatrix4fv(handViewProjectionLoc_, 1, GL_FALSE, glm::value_ptr(viewProjection));
-        glBindVertexArray(handVao_);
-        glBindBuffer(GL_ARRAY_BUFFER, handVbo_);
-
-        auto drawHand = [&](const HandJointRenderState& hand,
-                            const glm::vec3& lineColor,
-                            const glm::vec3& tipColor) {
+        struct HandPalette {
+            const HandJointRenderState* hand;
+            glm::vec3 lineColor;
+            glm::vec3 tipColor;
+        };
+        const std::array<HandPalette, 2> hands{{
+            {&leftHandJointRender_, glm::vec3(0.70f, 0.93f, 0.98f), glm::vec3(0.92f, 0.99f, 1.00f)},
+            {&rightHandJointRender_, glm::vec3(1.00f, 0.86f, 0.64f), glm::vec3(1.00f, 0.96f, 0.86f)},
+        }};
+
+        size_t lineCount = 0;
+        for (const HandPalette& palette : hands) {
+            const HandJointRenderState& hand = *palette.hand;
             if (!hand.isActive) {
-                return;
+                continue;
             }
-
-            std::array<glm::vec3, kHandBones.size() * 2> lineVertices{};
-            GLsizei lineVertexCount = 0;
+            const glm::vec4 color(palette.lineColor, 0.88f);
             for (const HandBone& bone : kHandBones) {
                 const int from = static_cast<int>(bone.from);
                 const int to = static_cast<int>(bone.to);
@@ -2273,64 +4179,87 @@ private:
                     continue;
                 }
 
-                lineVertices[static_cast<size_t>(lineVertexCount++)] = hand.positions[static_cast<size_t>(from)];
-                lineVertices[static_cast<size_t>(lineVertexCount++)] = hand.positions[static_cast<size_t>(to)];
+                handOverlayVertices_[lineCount++] = {hand.positions[static_cast<size_t>(from)], color, 1.0f};
+                handOverlayVertices_[lineCount++] = {hand.positions[static_cast<size_t>(to)], color, 1.0f};
             }
+        }
 
-            if (lineVertexCount > 0) {
-                glBufferData(GL_ARRAY_BUFFER,
-                             static_cast<GLsizeiptr>(lineVertexCount) * sizeof(glm::vec3),
-                             lineVertices.data(),
-                             GL_DYNAMIC_DRAW);
-                glUniform4f(handColorLoc_, lineColor.r, lineColor.g, lineColor.b, 0.88f);
-                glUniform1f(handPointSizeLoc_, 1.0f);
-                glDrawArrays(GL_LINES, 0, lineVertexCount);
+        size_t pointCount = 0;
+        HandOverlayVertex* points = handOverlayVertices_.data() + lineCount;
+        for (const HandPalette& palette : hands) {
+            const HandJointRenderState& hand = *palette.hand;
+            if (!hand.isActive) {
+                continue;
             }
-
-            std::array<glm::vec3, XR_HAND_JOINT_COUNT_EXT> jointVertices{};
-            GLsizei jointVertexCount = 0;
+            const glm::vec4 color(palette.lineColor, 0.65f);
             for (uint32_t i = 0; i < XR_HAND_JOINT_COUNT_EXT; ++i) {
-                if (hand.tracked[i] == 0) {
-                    continue;
+                if (hand.tracked[i] != 0) {
+                    points[pointCount++] = {hand.positions[i], color, 6.0f};
                 }
-                jointVertices[static_cast<size_t>(jointVertexCount++)] = hand.positions[i];
             }
-
-            if (jointVertexCount > 0) {
-                glBufferData(GL_ARRAY_BUFFER,
-                             static_cast<GLsizeiptr>(jointVertexCount) * sizeof(glm::vec3),
-                             jointVertices.data(),
-                             GL_DYNAMIC_DRAW);
-                glUniform4f(handColorLoc_, lineColor.r, lineColor.g, lineColor.b, 0.65f);
-                glUniform1f(handPointSizeLoc_, 6.0f);
-                glDrawArrays(GL_POINTS, 0, jointVertexCount);
+        }
+        for (const HandPalette& palette : hands) {
+            const HandJointRenderState& hand = *palette.hand;
+            if (!hand.isActive) {
+                continue;
             }
-
-            std::array<glm::vec3, kHandHighlightJoints.size()> tipVertices{};
-            GLsizei tipVertexCount = 0;
+            const glm::vec4 color(palette.tipColor, 0.95f);
             for (const XrHandJointEXT joint : kHandHighlightJoints) {
                 const uint32_t index = static_cast<uint32_t>(joint);
-                if (index >= XR_HAND_JOINT_COUNT_EXT || hand.tracked[index] == 0) {
-                    continue;
+                if (index < XR_HAND_JOINT_COUNT_EXT && hand.tracked[index] != 0) {
+                    points[pointCount++] = {hand.positions[index], color, 11.0f};
                 }
-                tipVertices[static_cast<size_t>(tipVertexCount++)] = hand.positions[index];
             }
+        }
 
-            if (tipVertexCount > 0) {
-                glBufferData(GL_ARRAY_BUFFER,
-                             static_cast<GLsizeiptr>(tipVertexCount) * sizeof(glm::vec3),
-                             tipVertices.data(),
-                             GL_DYNAMIC_DRAW);
-                glUniform4f(handColorLoc_, tipColor.r, tipColor.g, tipColor.b, 0.95f);
-                glUniform1f(handPointSizeLoc_, 11.0f);
-                glDrawArrays(GL_POINTS, 0, tipVertexCount);
-            }
-        };
+        const size_t vertexCount = lineCount + pointCount;
+        if (vertexCount == 0) {
+            return;
+        }
+
+        glBindBuffer(GL_ARRAY_BUFFER, handVbo_);
+        // Orphan first: the previous frame's eye passes may still read the old storage, and overwriting it in place
+        // would make the driver stall or copy.
+        glBufferData(GL_ARRAY_BUFFER,
+                     static_cast<GLsizeiptr>(handOverlayVertices_.size() * sizeof(HandOverlayVertex)),
+                     nullptr,
+                     GL_STREAM_DRAW);
+        glBufferSubData(GL_ARRAY_BUFFER,
+                        0,
+                        static_cast<GLsizeiptr>(vertexCount * sizeof(HandOverlayVertex)),
+                        handOverlayVertices_.data());
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        handOverlayLineVertexCount_ = static_cast<GLsizei>(lineCount);
+        handOverlayPointVertexCount_ = static_cast<GLsizei>(pointCount);
+    }
 
-        drawHand(leftHandJointRender_, glm::vec3(0.70f, 0.93f, 0.98f), glm::vec3(0.92f, 0.99f, 1.00f));
-        drawHand(rightHandJointRender_, glm::vec3(1.00f, 0.86f, 0.64f), glm::vec3(1.00f, 0.96f, 0.86f));
+    void RenderHandJoints(const glm::mat4& viewProjection, bool timePass) {
+        if (handProgram_ == 0 || handVao_ == 0 || handVbo_ == 0) {
+            return;
+        }
+        if (handOverlayLineVertexCount_ == 0 && handOverlayPointVertexCount_ == 0) {
+            return;
+        }
 
+        if (timePass) {
+            BeginGpuPassTimer(handsPassTimer_);
+        }
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        glDisable(GL_DEPTH_TEST);
+        glUseProgram(handProgram_);
+        glUniformMatrix4fv(handViewProjectionLoc_, 1, GL_FALSE, glm::value_ptr(viewProjection));
+        glBindVertexArray(handVao_);
+        if (handOverlayLineVertexCount_ > 0) {
+            glDrawArrays(GL_LINES, 0, handOverlayLineVertexCount_);
+        }
+        if (handOverlayPointVertexCount_ > 0) {
+            glDrawArrays(GL_POINTS, handOverlayLineVertexCount_, handOverlayPointVertexCount_);
+        }
         glBindVertexArray(0);
+        if (timePass) {
+            EndGpuPassTimer(handsPassTimer_);
+        }
     }
 
     void BuildSphereMesh() {
@@ -2401,28 +4330,58 @@ private:
     }
 
     bool InitializeProjectM() {
-        projectM_ = projectm_create();
-        if (!projectM_) {
-            LOGE("projectm_create failed. Ensure GLES context is current and compatible.");
+        bool asyncRender = kDefaultProjectMAsyncRenderEnabled;
+        std::string asyncRenderText;
+        if (ReadSystemProperty("debug.projectm.quest.perf.async_render", asyncRenderText)) {
+            ParseBoolText(asyncRenderText, asyncRender);
+        }
+        projectMAsyncRender_ = asyncRender && StartProjectMRenderThread();
+        if (asyncRender && !projectMAsyncRender_) {
+            LOGW("projectM render thread unavailable; rendering projectM on the main thread.");
+        }
+        LOGI("projectM rendering on %s", projectMAsyncRender_ ? "a dedicated thread (shared EGL context)" : "the main thread");
+
+        meshWidth_ = meshCapWidth_;
+        meshHeight_ = meshCapHeight_;
+        const bool created = RunProjectMJobAndWait([this]() {
+            // Vertex arrays and framebuffers are per-context, so the SGSR pass lives on the projectM context.
+            if (!InitializeSgsrUpscaler()) {
+                LOGW("SGSR upscaler unavailable. Falling back to native projectM resolution.");
+            }
+            InitializeGpuPassTimers({&projectMPassTimer_, &upscalePassTimer_});
+
+            projectM_ = projectm_create();
+            if (!projectM_) {
+                LOGE("projectm_create failed. Ensure GLES context is current and compatible.");
+                return false;
+            }
+
+            projectm_set_window_size(projectM_, projectMOutputWidth_, projectMOutputHeight_);
+            ApplyProjectMMeshSize(meshWidth_, meshHeight_);
+            projectm_set_fps(projectM_, static_cast<int32_t>(std::lround(activeDisplayRefreshRate_)));
+            projectm_set_hard_cut_enabled(projectM_, true);
+            projectm_set_hard_cut_duration(projectM_, 15.0);
+            projectm_set_hard_cut_sensitivity(projectM_, 1.4f);
+            return true;
+        });
+        if (!created) {
             return false;
         }
 
-        projectm_set_window_size(projectM_, projectMOutputWidth_, projectMOutputHeight_);
-        meshWidth_ = kDefaultMeshWidth;
-        meshHeight_ = kDefaultMeshHeight;
-        projectm_set_mesh_size(projectM_, meshWidth_, meshHeight_);
-        projectm_set_fps(projectM_, 72);
-        projectm_set_hard_cut_enabled(projectM_, true);
-        projectm_set_hard_cut_duration(projectM_, 15.0);
-        projectm_set_hard_cut_sensitivity(projectM_, 1.4f);
-
         const std::string appDataPath(app_->activity->internalDataPath ? app_->activity->internalDataPath : "");
         const std::string presetOutputDir = appDataPath + "/presets";
         const std::string textureOutputDir = appDataPath + "/textures";
         presetDirectory_ = presetOutputDir;
         slowPresetFilePath_ = appDataPath.empty() ? std::string() : (appDataPath + "/slow_presets.txt");
         favoritePresetFilePath_ = appDataPath.empty() ? std::string() : (appDataPath + "/favorite_presets.txt");
-
+        gpuStatsFilePath_ = appDataPath.empty() ? std::string() : (appDataPath + "/gpu_pass_stats.json");
+        presetMeshFilePath_ = appDataPath.empty() ? std::string() : (appDataPath + "/preset_mesh_sizes.txt");
+        presetGpuCostFilePath_ = appDataPath.empty() ? std::string() : (appDataPath + "/preset_gpu_costs.txt");
+        qualityLadderFilePath_ = appDataPath.empty() ? std::string() : (appDataPath + "/quality_ladder.txt");
+        renderTargetFormatFilePath_ =
+            appDataPath.empty() ? std::string() : (appDataPath + "/render_target_format.txt");
+
+        RequestPerformanceBoost(kPerfBoostStartupSeconds);
         if (app_->activity->assetManager != nullptr) {
             CopyAssetDirectoryFlat(app_->activity->assetManager, "presets", presetOutputDir);
             CopyAssetDirectoryFlat(app_->activity->assetManager, "textures", textureOutputDir);
@@ -2430,6 +4389,10 @@ private:
 
         LoadSlowPresetList();
         LoadFavoritePresetList();
+        LoadPresetMeshSizes();
+        LoadPresetGpuCosts();
+        LoadQualityLadderFile();
+        LoadRenderTargetFormatFile();
         presetFiles_ = CollectPresetFiles(presetOutputDir);
         InvalidateSelectablePresetCountCache();
         if (!presetFiles_.empty()) {
@@ -2443,21 +4406,22 @@ private:
                 }
             }
 
-            projectm_load_preset_file(projectM_, presetFiles_[currentPresetIndex_].c_str(), false);
+            LoadProjectMPresetFile(presetFiles_[currentPresetIndex_], 0.0);
             LOGI("Loaded first preset from assets: %s", presetFiles_[currentPresetIndex_].c_str());
             usingFallbackPreset_ = false;
             currentPresetLabel_ = BuildPresetDisplayLabel(presetFiles_[currentPresetIndex_]);
         } else {
-            projectm_load_preset_data(projectM_, kFallbackPreset, false);
+            PostProjectMJob([this]() { projectm_load_preset_data(projectM_, kFallbackPreset, false); });
             LOGW("No preset assets found, using built-in fallback preset.");
             usingFallbackPreset_ = true;
             currentPresetLabel_ = "FALLBACK";
         }
-        hudTextDirty_ = true;
 
         if (EnsureDirectory(textureOutputDir)) {
-            const char* texturePath = textureOutputDir.c_str();
-            projectm_set_texture_search_paths(projectM_, &texturePath, 1);
+            PostProjectMJob([this, textureOutputDir]() {
+                const char* texturePath = textureOutputDir.c_str();
+                projectm_set_texture_search_paths(projectM_, &texturePath, 1);
+            });
         }
 
         std::string sgsrText;
@@ -2467,11 +4431,18 @@ private:
                 sgsrEnabled_ = parsedSgsr;
             }
         }
+        std::string formatText;
+        if (ReadSystemProperty("debug.projectm.quest.perf.format.source", formatText)) {
+            ParseRenderTargetFormatText(formatText, sourceFormatSetting_);
+        }
+        if (ReadSystemProperty("debug.projectm.quest.perf.format.output", formatText)) {
+            ParseRenderTargetFormatText(formatText, outputFormatSetting_);
+        }
         std::string renderScaleText;
         if (ReadSystemProperty("debug.projectm.quest.perf.render_scale", renderScaleText)) {
             float parsedRenderScale = projectMRenderScale_;
             if (ParseFloatText(renderScaleText, parsedRenderScale)) {
-                projectMRenderScale_ = std::clamp(parsedRenderScale, kMinProjectMRenderScale, 1.0f);
+                projectMRenderScale_ = std::clamp(parsedRenderScale, MinProjectMRenderScale(), 1.0f);
             }
         }
         projectMAdaptiveRenderScale_ = projectMRenderScale_;
@@ -2484,30 +4455,27 @@ private:
         return true;
     }
 
-    bool CreateColorTexture(GLuint& textureOut, int width, int height) {
+    // Immutable storage: the driver knows the size and format up front and never has to re-validate mip levels.
+    bool CreateColorTexture(GLuint& textureOut,
+                            int width,
+                            int height,
+                            RenderTargetFormat format = RenderTargetFormat::Rgba8) {
         glGenTextures(1, &textureOut);
         if (textureOut == 0) {
             return false;
         }
+        const RenderTargetFormatInfo formatInfo = GetRenderTargetFormatInfo(format);
         glBindTexture(GL_TEXTURE_2D, textureOut);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-        glTexImage2D(GL_TEXTURE_2D,
-                     0,
-                     GL_RGBA,
-                     width,
-                     height,
-                     0,
-                     GL_RGBA,
-                     GL_UNSIGNED_BYTE,
-                     nullptr);
+        glTexStorage2D(GL_TEXTURE_2D, 1, formatInfo.internalFormat, width, height);
         glBindTexture(GL_TEXTURE_2D, 0);
 
         const GLenum err = glGetError();
         if (err != GL_NO_ERROR) {
-            LOGE("CreateColorTexture failed (%d x %d): 0x%x", width, height, err);
+            LOGE("CreateColorTexture failed (%d x %d %s): 0x%x", width, height, formatInfo.label, err);
             glDeleteTextures(1, &textureOut);
             textureOut = 0;
             return false;
@@ -2516,63 +4484,507 @@ private:
         return true;
     }
 
+    // Drops formats the projectM context can't render to. R11F_G11F_B10F needs GL_EXT_color_buffer_float on
+    // GLES 3.0. Auto arrives here already replaced by the probed format (see UpdateRenderTargetFormatProbe).
+    RenderTargetFormat ResolveRenderTargetFormat(RenderTargetFormat requested) const {
+        if (requested == RenderTargetFormat::Auto) {
+            requested = RenderTargetFormat::Rgba8;
+        }
+        if (requested == RenderTargetFormat::R11G11B10F && !colorBufferFloatSupported_) {
+            return RenderTargetFormat::Rgb10A2;
+        }
+        return requested;
+    }
+
     bool BuildFramebuffer(GLuint& framebufferOut, GLuint colorTexture) {
         glGenFramebuffers(1, &framebufferOut);
         if (framebufferOut == 0) {
             return false;
         }
-        glBindFramebuffer(GL_FRAMEBUFFER, framebufferOut);
-        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, colorTexture, 0);
-        const GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
-        glBindFramebuffer(GL_FRAMEBUFFER, 0);
-        if (status != GL_FRAMEBUFFER_COMPLETE) {
-            LOGE("Framebuffer incomplete: 0x%x", status);
-            glDeleteFramebuffers(1, &framebufferOut);
-            framebufferOut = 0;
-            return false;
+        glBindFramebuffer(GL_FRAMEBUFFER, framebufferOut);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, colorTexture, 0);
+        const GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        if (status != GL_FRAMEBUFFER_COMPLETE) {
+            LOGE("Framebuffer incomplete: 0x%x", status);
+            glDeleteFramebuffers(1, &framebufferOut);
+            framebufferOut = 0;
+            return false;
+        }
+        return true;
+    }
+
+    void DestroyProjectMRenderTargets() {
+        {
+            std::lock_guard<std::mutex> lock(projectMOutputMutex_);
+            for (ProjectMOutputSlot& slot : projectMOutputSlots_) {
+                if (slot.fence != nullptr) {
+                    glDeleteSync(slot.fence);
+                    slot.fence = nullptr;
+                }
+                if (slot.framebuffer != 0) {
+                    glDeleteFramebuffers(1, &slot.framebuffer);
+                    slot.framebuffer = 0;
+                }
+                if (slot.texture != 0) {
+                    glDeleteTextures(1, &slot.texture);
+                    slot.texture = 0;
+                }
+                slot.frameId = 0;
+                slot.presetGeneration = 0;
+            }
+            projectMDisplaySlot_ = kNoProjectMOutputSlot;
+            projectMPreviousSlot_ = kNoProjectMOutputSlot;
+            projectMPublishedSlot_ = kNoProjectMOutputSlot;
+        }
+        if (projectMFbo_ != 0) {
+            glDeleteFramebuffers(1, &projectMFbo_);
+            projectMFbo_ = 0;
+        }
+        if (projectMLowResTexture_ != 0) {
+            glDeleteTextures(1, &projectMLowResTexture_);
+            projectMLowResTexture_ = 0;
+        }
+    }
+
+    // Output slots are allocated on first use: a single-threaded run at full cadence only ever touches two of them.
+    bool EnsureProjectMOutputSlot(ProjectMOutputSlot& slot) {
+        if (slot.texture != 0 && slot.framebuffer != 0) {
+            return true;
+        }
+        if (!CreateColorTexture(slot.texture,
+                                static_cast<int>(projectMOutputWidth_),
+                                static_cast<int>(projectMOutputHeight_),
+                                projectMOutputFormat_)) {
+            return false;
+        }
+        if (!BuildFramebuffer(slot.framebuffer, slot.texture)) {
+            glDeleteTextures(1, &slot.texture);
+            slot.texture = 0;
+            return false;
+        }
+        return true;
+    }
+
+    // Picks the slot the next projectM frame renders into. With a render thread the eye pass may still be sampling
+    // the display and previous slots, so those are never written; an unconsumed published frame is only overwritten
+    // when no other slot is free. A fence left by the main thread on release is waited on GPU-side before reuse.
+    int AcquireProjectMWriteSlot() {
+        std::lock_guard<std::mutex> lock(projectMOutputMutex_);
+        int writeSlot = kNoProjectMOutputSlot;
+        for (int i = 0; i < static_cast<int>(kProjectMOutputSlotCount); ++i) {
+            if (i == projectMDisplaySlot_ || i == projectMPublishedSlot_ ||
+                (projectMAsyncRender_ && i == projectMPreviousSlot_)) {
+                continue;
+            }
+            writeSlot = i;
+            break;
+        }
+        if (writeSlot == kNoProjectMOutputSlot && projectMPublishedSlot_ != kNoProjectMOutputSlot) {
+            writeSlot = projectMPublishedSlot_;
+            projectMPublishedSlot_ = kNoProjectMOutputSlot;
+            ++projectMFramesDropped_;
+        }
+        if (writeSlot != kNoProjectMOutputSlot) {
+            ProjectMOutputSlot& slot = projectMOutputSlots_[static_cast<size_t>(writeSlot)];
+            if (slot.fence != nullptr) {
+                glWaitSync(slot.fence, 0, GL_TIMEOUT_IGNORED);
+                glDeleteSync(slot.fence);
+                slot.fence = nullptr;
+            }
+        }
+        return writeSlot;
+    }
+
+    void PublishProjectMFrame(int slotIndex) {
+        GLsync fence = nullptr;
+        if (projectMAsyncRender_) {
+            fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            glFlush();
+        }
+        {
+            std::lock_guard<std::mutex> lock(projectMOutputMutex_);
+            projectMOutputSlots_[static_cast<size_t>(slotIndex)].fence = fence;
+            if (projectMPublishedSlot_ != kNoProjectMOutputSlot) {
+                ++projectMFramesDropped_;
+            }
+            projectMPublishedSlot_ = slotIndex;
+        }
+        ++projectMFramesProduced_;
+    }
+
+    // Adopts the newest published projectM frame once its fence has signaled, so the eye pass never waits on
+    // projectM. Slots the eye pass stops sampling get a fence the render thread waits on before rewriting them.
+    bool ConsumeNewestProjectMFrame(double nowSeconds, bool keepPrevious) {
+        std::lock_guard<std::mutex> lock(projectMOutputMutex_);
+        if (projectMPublishedSlot_ == kNoProjectMOutputSlot) {
+            return false;
+        }
+        ProjectMOutputSlot& published = projectMOutputSlots_[static_cast<size_t>(projectMPublishedSlot_)];
+        if (published.fence != nullptr) {
+            if (glClientWaitSync(published.fence, 0, 0) == GL_TIMEOUT_EXPIRED) {
+                return false;
+            }
+            glDeleteSync(published.fence);
+            published.fence = nullptr;
+        }
+
+        const std::array<int, 2> releasedSlots = {
+            projectMPreviousSlot_,
+            keepPrevious ? kNoProjectMOutputSlot : projectMDisplaySlot_,
+        };
+        projectMPreviousSlot_ = keepPrevious ? projectMDisplaySlot_ : kNoProjectMOutputSlot;
+        projectMDisplaySlot_ = projectMPublishedSlot_;
+        projectMPublishedSlot_ = kNoProjectMOutputSlot;
+        if (projectMAsyncRender_) {
+            bool fenced = false;
+            for (const int released : releasedSlots) {
+                if (released == kNoProjectMOutputSlot) {
+                    continue;
+                }
+                ProjectMOutputSlot& slot = projectMOutputSlots_[static_cast<size_t>(released)];
+                if (slot.fence != nullptr) {
+                    glDeleteSync(slot.fence);
+                }
+                slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+                fenced = true;
+            }
+            if (fenced) {
+                glFlush();
+            }
+        }
+
+        projectMDisplayPresetGeneration_ = published.presetGeneration;
+        const double staleness = std::max(0.0, nowSeconds - published.requestedSeconds);
+        projectMStalenessSmoothedSeconds_ +=
+            (staleness - projectMStalenessSmoothedSeconds_) * static_cast<double>(kProjectMStalenessSmoothing);
+        projectMStalenessMaxSeconds_ = std::max(projectMStalenessMaxSeconds_, staleness);
+        ++projectMFramesConsumed_;
+        SyncProjectMDisplayTexturesLocked();
+        return true;
+    }
+
+    void SyncProjectMDisplayTexturesLocked() {
+        projectMTexture_ = projectMDisplaySlot_ != kNoProjectMOutputSlot
+                               ? projectMOutputSlots_[static_cast<size_t>(projectMDisplaySlot_)].texture
+                               : 0;
+        projectMPreviousTexture_ = projectMPreviousSlot_ != kNoProjectMOutputSlot
+                                       ? projectMOutputSlots_[static_cast<size_t>(projectMPreviousSlot_)].texture
+                                       : 0;
+    }
+
+    void ProduceProjectMFrame(double requestedSeconds) {
+        if (!projectM_ || (projectMUseUpscaler_ && projectMFbo_ == 0)) {
+            return;
+        }
+        if (PollProjectMWatchdog()) {
+            return;
+        }
+
+        DrainPendingProjectMPcm();
+        ApplyPendingProjectMViewportSize(false);
+        const int slotIndex = AcquireProjectMWriteSlot();
+        if (slotIndex == kNoProjectMOutputSlot) {
+            return;
+        }
+        ProjectMOutputSlot& slot = projectMOutputSlots_[static_cast<size_t>(slotIndex)];
+        if (!EnsureProjectMOutputSlot(slot)) {
+            return;
+        }
+
+        const double projectMFrameDelta = requestedSeconds - lastProjectMFrameSeconds_;
+        const bool hadPreviousFrame = lastProjectMFrameSeconds_ > 0.0;
+        lastProjectMFrameSeconds_ = requestedSeconds;
+        if (hadPreviousFrame && projectMFrameDelta > 0.0001) {
+            projectm_set_fps(projectM_, static_cast<int32_t>(std::clamp(1.0 / projectMFrameDelta, 1.0, 240.0)));
+        }
+
+        const GLuint renderFramebuffer = projectMUseUpscaler_ ? projectMFbo_ : slot.framebuffer;
+        glBindFramebuffer(GL_FRAMEBUFFER, renderFramebuffer);
+        glViewport(0, 0,
+                   static_cast<GLsizei>(projectMViewportWidth_),
+                   static_cast<GLsizei>(projectMViewportHeight_));
+        glDisable(GL_BLEND);
+        BeginGpuPassTimer(projectMPassTimer_);
+        const auto cpuStart = std::chrono::steady_clock::now();
+        projectm_opengl_render_frame_fbo(projectM_, renderFramebuffer);
+        const float cpuMs =
+            std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - cpuStart).count();
+        AddPassSample(projectMCpuWindow_, cpuMs);
+        LogProjectMResizeCost(cpuMs);
+        EndGpuPassTimer(projectMPassTimer_);
+        ArmProjectMWatchdog(cpuStart, cpuMs);
+        if (projectMUseUpscaler_) {
+            BeginGpuPassTimer(upscalePassTimer_);
+            RenderSgsrUpscalePass(slot.framebuffer);
+            EndGpuPassTimer(upscalePassTimer_);
+        }
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+        slot.frameId = ++projectMNextFrameId_;
+        slot.presetGeneration = projectMRenderPresetGeneration_;
+        slot.requestedSeconds = requestedSeconds;
+        PublishGpuPassStats({{GpuPass::ProjectM, &projectMPassTimer_}, {GpuPass::Upscale, &upscalePassTimer_}},
+                            projectMGpuStatsPublishSeconds_,
+                            static_cast<uint32_t>(projectMViewportWidth_ * projectMViewportHeight_));
+        PublishProjectMCpuStats();
+        PublishProjectMFrame(slotIndex);
+    }
+
+    // Requests coalesce: if the render thread is still busy, only the newest display frame's request survives.
+    void RequestProjectMFrame(double nowSeconds) {
+        if (!projectMAsyncRender_) {
+            ProduceProjectMFrame(nowSeconds);
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(projectMThreadMutex_);
+            if (projectMFrameRequested_) {
+                ++projectMFrameRequestsCoalesced_;
+            }
+            projectMFrameRequested_ = true;
+            projectMRequestedFrameSeconds_ = nowSeconds;
+        }
+        projectMThreadCondition_.notify_one();
+    }
+
+    void SubmitPcmToProjectM(const float* samples, size_t frameCount) {
+        if (frameCount == 0) {
+            return;
+        }
+        if (!projectMAsyncRender_) {
+            projectm_pcm_add_float(projectM_, samples, static_cast<unsigned int>(frameCount), PROJECTM_STEREO);
+            return;
+        }
+        std::lock_guard<std::mutex> lock(projectMThreadMutex_);
+        projectMPendingPcm_.insert(projectMPendingPcm_.end(), samples, samples + frameCount * 2);
+        const size_t maxSamples = kMaxPendingProjectMPcmFrames * 2;
+        if (projectMPendingPcm_.size() > maxSamples) {
+            projectMPendingPcm_.erase(projectMPendingPcm_.begin(),
+                                      projectMPendingPcm_.end() - static_cast<std::ptrdiff_t>(maxSamples));
+        }
+    }
+
+    void DrainPendingProjectMPcm() {
+        if (!projectMAsyncRender_) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(projectMThreadMutex_);
+            projectMPcmScratch_.swap(projectMPendingPcm_);
+        }
+        if (!projectMPcmScratch_.empty()) {
+            projectm_pcm_add_float(projectM_,
+                                   projectMPcmScratch_.data(),
+                                   static_cast<unsigned int>(projectMPcmScratch_.size() / 2),
+                                   PROJECTM_STEREO);
+            projectMPcmScratch_.clear();
+        }
+    }
+
+    // blendSeconds 0 is a hard cut. Every load gets a new generation, stamped on the frames rendered after it, so the
+    // main thread can tell when the load has reached the screen.
+    void LoadProjectMPresetFile(const std::string& presetPath, double blendSeconds) {
+        const uint64_t generation = ++projectMRequestedPresetGeneration_;
+        // Each preset starts at the mesh size it settled on last time, set before the load so it is parsed once.
+        const std::pair<int, int> mesh = PresetMeshSize(presetPath);
+        const bool meshChanged = mesh.first != meshWidth_ || mesh.second != meshHeight_;
+        meshWidth_ = mesh.first;
+        meshHeight_ = mesh.second;
+        lastMeshChangeSeconds_ = ElapsedSeconds();
+        meshUpgradeSinceSeconds_ = -1.0;
+        PostProjectMJob([this, presetPath, blendSeconds, mesh, meshChanged, generation]() {
+            if (meshChanged) {
+                ApplyProjectMMeshSize(mesh.first, mesh.second);
+            }
+            if (blendSeconds > 0.0) {
+                projectm_set_soft_cut_duration(projectM_, blendSeconds);
+            }
+            projectm_load_preset_file(projectM_, presetPath.c_str(), blendSeconds > 0.0);
+            projectMRenderPresetGeneration_ = generation;
+            ResetProjectMPassSamples();
+            ResetProjectMWatchdog();
+        });
+    }
+
+    bool OnProjectMRenderThread() const {
+        return projectMAsyncRender_ && std::this_thread::get_id() == projectMThread_.get_id();
+    }
+
+    void PostProjectMJob(std::function<void()> job) {
+        if (!projectMAsyncRender_ || OnProjectMRenderThread()) {
+            job();
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(projectMThreadMutex_);
+            projectMJobs_.push_back(std::move(job));
+        }
+        projectMThreadCondition_.notify_one();
+    }
+
+    bool RunProjectMJobAndWait(const std::function<bool()>& job) {
+        if (!projectMAsyncRender_ || OnProjectMRenderThread()) {
+            return job();
+        }
+        std::promise<bool> done;
+        std::future<bool> result = done.get_future();
+        PostProjectMJob([&job, &done]() { done.set_value(job()); });
+        return result.get();
+    }
+
+    // projectM gets its own EGL context in the main context's share group. Textures and sync objects are shared;
+    // framebuffers and vertex arrays are not, so every GL object projectM renders through is created on its thread.
+    bool StartProjectMRenderThread() {
+        const EGLint contextAttributes[] = {
+            EGL_CONTEXT_CLIENT_VERSION, 3,
+            EGL_NONE,
+        };
+        projectMEglContext_ = eglCreateContext(eglDisplay_, eglConfig_, eglContext_, contextAttributes);
+        if (projectMEglContext_ == EGL_NO_CONTEXT) {
+            LOGW("eglCreateContext for the projectM render thread failed: 0x%x", eglGetError());
+            return false;
+        }
+
+        const EGLint pbufferAttributes[] = {
+            EGL_WIDTH, 16,
+            EGL_HEIGHT, 16,
+            EGL_NONE,
+        };
+        projectMEglSurface_ = eglCreatePbufferSurface(eglDisplay_, eglConfig_, pbufferAttributes);
+        if (projectMEglSurface_ == EGL_NO_SURFACE) {
+            LOGW("eglCreatePbufferSurface for the projectM render thread failed: 0x%x", eglGetError());
+            DestroyProjectMEglContext();
+            return false;
+        }
+
+        std::promise<bool> started;
+        std::future<bool> startedResult = started.get_future();
+        projectMThreadStop_ = false;
+        projectMThread_ = std::thread([this, started = std::move(started)]() mutable {
+            ProjectMRenderThreadMain(started);
+        });
+        if (!startedResult.get()) {
+            projectMThread_.join();
+            DestroyProjectMEglContext();
+            return false;
+        }
+        return true;
+    }
+
+    void ProjectMRenderThreadMain(std::promise<bool>& started) {
+        if (eglMakeCurrent(eglDisplay_, projectMEglSurface_, projectMEglSurface_, projectMEglContext_) != EGL_TRUE) {
+            LOGW("eglMakeCurrent on the projectM render thread failed: 0x%x", eglGetError());
+            started.set_value(false);
+            return;
+        }
+        started.set_value(true);
+
+        while (true) {
+            std::function<void()> job;
+            double requestedSeconds = 0.0;
+            {
+                std::unique_lock<std::mutex> lock(projectMThreadMutex_);
+                projectMThreadCondition_.wait(lock, [this]() {
+                    return projectMThreadStop_ || !projectMJobs_.empty() || projectMFrameRequested_;
+                });
+                if (!projectMJobs_.empty()) {
+                    job = std::move(projectMJobs_.front());
+                    projectMJobs_.pop_front();
+                } else if (projectMThreadStop_) {
+                    break;
+                } else {
+                    projectMFrameRequested_ = false;
+                    requestedSeconds = projectMRequestedFrameSeconds_;
+                }
+            }
+            if (job) {
+                job();
+            } else {
+                ProduceProjectMFrame(requestedSeconds);
+            }
+        }
+
+        eglMakeCurrent(eglDisplay_, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    }
+
+    void StopProjectMRenderThread() {
+        if (projectMThread_.joinable()) {
+            {
+                std::lock_guard<std::mutex> lock(projectMThreadMutex_);
+                projectMThreadStop_ = true;
+                projectMFrameRequested_ = false;
+            }
+            projectMThreadCondition_.notify_all();
+            projectMThread_.join();
+        }
+        projectMAsyncRender_ = false;
+        DestroyProjectMEglContext();
+    }
+
+    void DestroyProjectMEglContext() {
+        if (projectMEglSurface_ != EGL_NO_SURFACE) {
+            eglDestroySurface(eglDisplay_, projectMEglSurface_);
+            projectMEglSurface_ = EGL_NO_SURFACE;
+        }
+        if (projectMEglContext_ != EGL_NO_CONTEXT) {
+            eglDestroyContext(eglDisplay_, projectMEglContext_);
+            projectMEglContext_ = EGL_NO_CONTEXT;
         }
-        return true;
     }
 
-    void DestroyProjectMRenderTargets() {
-        if (projectMUpscaleFbo_ != 0) {
-            glDeleteFramebuffers(1, &projectMUpscaleFbo_);
-            projectMUpscaleFbo_ = 0;
+    void SetProjectMCadenceLevel(int level) {
+        level = std::clamp(level, 0, static_cast<int>(kProjectMCadenceRatios.size()) - 1);
+        if (level == projectMCadenceLevel_) {
+            return;
         }
-        if (projectMFbo_ != 0) {
-            glDeleteFramebuffers(1, &projectMFbo_);
-            projectMFbo_ = 0;
+        projectMCadenceLevel_ = level;
+        projectMCadenceAccumulator_ = 0.0f;
+        LOGI("projectM cadence set to %s of display rate", kProjectMCadenceLabels[static_cast<size_t>(level)]);
+    }
+
+    void RememberPresetCadenceLevel() {
+        if (currentPresetIndex_ >= presetFiles_.size()) {
+            return;
         }
-        if (projectMLowResTexture_ != 0) {
-            glDeleteTextures(1, &projectMLowResTexture_);
-            projectMLowResTexture_ = 0;
+        const std::string key = PresetHistoryKey(presetFiles_[currentPresetIndex_]);
+        if (projectMCadenceLevel_ > projectMCadenceBaseLevel_) {
+            presetCadenceLevels_[key] = projectMCadenceLevel_;
+        } else {
+            presetCadenceLevels_.erase(key);
         }
-        if (projectMTexture_ != 0) {
-            glDeleteTextures(1, &projectMTexture_);
-            projectMTexture_ = 0;
+    }
+
+    void ApplyPresetCadenceLevel() {
+        int level = projectMCadenceBaseLevel_;
+        if (perfAutoCadenceEnabled_ && currentPresetIndex_ < presetFiles_.size()) {
+            const auto it = presetCadenceLevels_.find(PresetHistoryKey(presetFiles_[currentPresetIndex_]));
+            if (it != presetCadenceLevels_.end()) {
+                level = std::max(level, it->second);
+            }
         }
+        SetProjectMCadenceLevel(level);
     }
 
+    // The SGSR source target is allocated at the requested scale and adaptive steps below it only move the viewport
+    // and SGSR source rect, so the performance guard never reallocates. Reallocation (SGSR on/off, a higher requested
+    // scale) runs on the projectM context while the main thread waits, and primes a frame so the eye pass never
+    // samples an empty slot.
     bool ApplyProjectMRenderConfiguration(bool forceLog = false) {
-        const float requestedScale = std::clamp(projectMRenderScale_, kMinProjectMRenderScale, 1.0f);
-        projectMAdaptiveRenderScale_ = std::clamp(projectMAdaptiveRenderScale_,
-                                                  kMinProjectMRenderScale,
-                                                  requestedScale);
+        const float minScale = MinProjectMRenderScale();
+        const float requestedScale = std::clamp(projectMRenderScale_, minScale, 1.0f);
+        projectMAdaptiveRenderScale_ = std::clamp(projectMAdaptiveRenderScale_, minScale, requestedScale);
 
         const bool sgsrAvailable = sgsrProgram_ != 0 && sgsrVao_ != 0;
         const bool useUpscaler = sgsrEnabled_ && sgsrAvailable && projectMAdaptiveRenderScale_ < 0.999f;
         const uint32_t outputWidth = useUpscaler ? kProjectMOutputWidthSgsr : kProjectMOutputWidthNative;
-        const uint32_t outputHeight = useUpscaler ? kProjectMOutputHeightSgsr : kProjectMOutputHeightNative;
+        const uint32_t outputHeight = static_cast<uint32_t>(std::lround(
+            static_cast<double>(useUpscaler ? kProjectMOutputHeightSgsr : kProjectMOutputHeightNative) *
+            CanvasHeightScale(canvasMappingSetting_)));
         const float effectiveScale = useUpscaler ? projectMAdaptiveRenderScale_ : 1.0f;
 
-        const int renderWidth = std::clamp(
-            static_cast<int>(std::lround(static_cast<double>(outputWidth) * effectiveScale)),
-            kMinProjectMRenderWidth,
-            static_cast<int>(outputWidth));
-        const int renderHeight = std::clamp(
-            static_cast<int>(std::lround(static_cast<double>(outputHeight) * effectiveScale)),
-            kMinProjectMRenderHeight,
-            static_cast<int>(outputHeight));
+        const int renderWidth = ScaledProjectMDimension(outputWidth, effectiveScale, kMinProjectMRenderWidth);
+        const int renderHeight = ScaledProjectMDimension(outputHeight, effectiveScale, kMinProjectMRenderHeight);
 
         const bool unchanged =
             !forceLog &&
@@ -2581,52 +4993,75 @@ private:
             projectMRenderWidth_ == renderWidth &&
             projectMRenderHeight_ == renderHeight &&
             projectMUseUpscaler_ == useUpscaler &&
-            projectMTexture_ != 0 &&
-            projectMFbo_ != 0 &&
-            (!useUpscaler || (projectMLowResTexture_ != 0 && projectMUpscaleFbo_ != 0));
+            appliedSourceFormatSetting_ == sourceFormatSetting_ &&
+            appliedOutputFormatSetting_ == outputFormatSetting_ &&
+            appliedAutoRenderTargetFormat_ == autoRenderTargetFormat_;
         if (unchanged) {
             return true;
         }
 
-        DestroyProjectMRenderTargets();
-
-        if (!CreateColorTexture(projectMTexture_, static_cast<int>(outputWidth), static_cast<int>(outputHeight))) {
-            return false;
-        }
-
-        if (useUpscaler) {
-            if (!CreateColorTexture(projectMLowResTexture_, renderWidth, renderHeight)) {
-                DestroyProjectMRenderTargets();
-                return false;
+        const bool reallocate =
+            forceLog ||
+            projectMUseUpscaler_ != useUpscaler ||
+            projectMOutputWidth_ != outputWidth ||
+            projectMOutputHeight_ != outputHeight ||
+            appliedSourceFormatSetting_ != sourceFormatSetting_ ||
+            appliedOutputFormatSetting_ != outputFormatSetting_ ||
+            appliedAutoRenderTargetFormat_ != autoRenderTargetFormat_ ||
+            (useUpscaler && (projectMFbo_ == 0 ||
+                             renderWidth > projectMLowResWidth_ ||
+                             renderHeight > projectMLowResHeight_));
+        bool applied = true;
+        if (reallocate) {
+            const int lowResWidth =
+                useUpscaler
+                    ? std::max(renderWidth, ScaledProjectMDimension(outputWidth, requestedScale, kMinProjectMRenderWidth))
+                    : 0;
+            const int lowResHeight =
+                useUpscaler
+                    ? std::max(renderHeight, ScaledProjectMDimension(outputHeight, requestedScale, kMinProjectMRenderHeight))
+                    : 0;
+            RequestPerformanceBoost(kPerfBoostAfterRenderReconfigSeconds);
+            if (projectMAsyncRender_) {
+                std::lock_guard<std::mutex> lock(projectMThreadMutex_);
+                projectMFrameRequested_ = false;
             }
-            if (!BuildFramebuffer(projectMFbo_, projectMLowResTexture_)) {
-                DestroyProjectMRenderTargets();
-                return false;
+            const RenderTargetFormat sourceFormat =
+                sourceFormatSetting_ == RenderTargetFormat::Auto ? autoRenderTargetFormat_ : sourceFormatSetting_;
+            const RenderTargetFormat outputFormat =
+                outputFormatSetting_ == RenderTargetFormat::Auto ? autoRenderTargetFormat_ : outputFormatSetting_;
+            applied = RunProjectMJobAndWait([this, useUpscaler, outputWidth, outputHeight, lowResWidth, lowResHeight,
+                                             renderWidth, renderHeight, sourceFormat, outputFormat]() {
+                return ReallocateProjectMRenderTargets(useUpscaler,
+                                                       outputWidth,
+                                                       outputHeight,
+                                                       lowResWidth,
+                                                       lowResHeight,
+                                                       renderWidth,
+                                                       renderHeight,
+                                                       sourceFormat,
+                                                       outputFormat);
+            });
+            appliedSourceFormatSetting_ = sourceFormatSetting_;
+            appliedOutputFormatSetting_ = outputFormatSetting_;
+            appliedAutoRenderTargetFormat_ = autoRenderTargetFormat_;
+            projectMCanvasMapping_ = canvasMappingSetting_;
+            displayFramesSinceProjectMFrame_ = 0;
+            if (!ConsumeNewestProjectMFrame(ElapsedSeconds(), false)) {
+                std::lock_guard<std::mutex> lock(projectMOutputMutex_);
+                SyncProjectMDisplayTexturesLocked();
             }
-            if (!BuildFramebuffer(projectMUpscaleFbo_, projectMTexture_)) {
-                DestroyProjectMRenderTargets();
+            if (!applied) {
                 return false;
             }
         } else {
-            if (!BuildFramebuffer(projectMFbo_, projectMTexture_)) {
-                DestroyProjectMRenderTargets();
-                return false;
-            }
+            PostProjectMJob([this, renderWidth, renderHeight]() { SetProjectMViewportSize(renderWidth, renderHeight); });
         }
 
-        projectMUseUpscaler_ = useUpscaler;
-        projectMOutputWidth_ = outputWidth;
-        projectMOutputHeight_ = outputHeight;
         projectMRenderWidth_ = renderWidth;
         projectMRenderHeight_ = renderHeight;
 
-        if (projectM_ != nullptr) {
-            projectm_set_window_size(projectM_,
-                                     static_cast<uint32_t>(projectMRenderWidth_),
-                                     static_cast<uint32_t>(projectMRenderHeight_));
-        }
-
-        LOGI("projectM render config: SGSR requested=%d available=%d active=%d targetScale=%.2f adaptiveScale=%.2f render=%d x %d output=%u x %u",
+        LOGI("projectM render config: SGSR requested=%d available=%d active=%d targetScale=%.2f adaptiveScale=%.2f render=%d x %d source=%d x %d output=%u x %u realloc=%d",
              sgsrEnabled_ ? 1 : 0,
              sgsrAvailable ? 1 : 0,
              projectMUseUpscaler_ ? 1 : 0,
@@ -2634,26 +5069,296 @@ private:
              effectiveScale,
              projectMRenderWidth_,
              projectMRenderHeight_,
+             projectMLowResWidth_,
+             projectMLowResHeight_,
              static_cast<unsigned>(projectMOutputWidth_),
-             static_cast<unsigned>(projectMOutputHeight_));
+             static_cast<unsigned>(projectMOutputHeight_),
+             reallocate ? 1 : 0);
+        return applied;
+    }
+
+    static int ScaledProjectMDimension(uint32_t outputDimension, float scale, int minDimension) {
+        return std::clamp(static_cast<int>(std::lround(static_cast<double>(outputDimension) * scale)),
+                          minDimension,
+                          static_cast<int>(outputDimension));
+    }
+
+    bool ReallocateProjectMRenderTargets(bool useUpscaler,
+                                         uint32_t outputWidth,
+                                         uint32_t outputHeight,
+                                         int lowResWidth,
+                                         int lowResHeight,
+                                         int renderWidth,
+                                         int renderHeight,
+                                         RenderTargetFormat sourceFormat,
+                                         RenderTargetFormat outputFormat) {
+        DestroyProjectMRenderTargets();
+        ResetProjectMPassSamples();
+        projectMLowResWidth_ = 0;
+        projectMLowResHeight_ = 0;
+
+        // Output slots are created lazily at the output size; only the SGSR source target is allocated here.
+        projectMSourceFormat_ = ResolveRenderTargetFormat(sourceFormat);
+        if (useUpscaler) {
+            if (!CreateSourceTarget(lowResWidth, lowResHeight)) {
+                LOGW("projectM source target unavailable as %s; falling back to RGBA8.",
+                     GetRenderTargetFormatInfo(projectMSourceFormat_).label);
+                projectMSourceFormat_ = RenderTargetFormat::Rgba8;
+                if (!CreateSourceTarget(lowResWidth, lowResHeight)) {
+                    return false;
+                }
+            }
+            projectMLowResWidth_ = lowResWidth;
+            projectMLowResHeight_ = lowResHeight;
+        }
+
+        projectMUseUpscaler_ = useUpscaler;
+        projectMOutputWidth_ = outputWidth;
+        projectMOutputHeight_ = outputHeight;
+        projectMOutputFormat_ = ResolveRenderTargetFormat(outputFormat);
+        if (!EnsureProjectMOutputSlot(projectMOutputSlots_[0])) {
+            LOGW("projectM output target unavailable as %s; falling back to RGBA8.",
+                 GetRenderTargetFormatInfo(projectMOutputFormat_).label);
+            projectMOutputFormat_ = RenderTargetFormat::Rgba8;
+            if (!EnsureProjectMOutputSlot(projectMOutputSlots_[0])) {
+                DestroyProjectMRenderTargets();
+                return false;
+            }
+        }
+        SetProjectMViewportSize(renderWidth, renderHeight, true);
+        LogProjectMTargetTraffic();
+
+        if (projectM_ != nullptr) {
+            ProduceProjectMFrame(ElapsedSeconds());
+            if (projectMAsyncRender_) {
+                glFinish();
+            }
+        }
+        return true;
+    }
+
+    bool CreateSourceTarget(int width, int height) {
+        if (!CreateColorTexture(projectMLowResTexture_, width, height, projectMSourceFormat_) ||
+            !BuildFramebuffer(projectMFbo_, projectMLowResTexture_)) {
+            DestroyProjectMRenderTargets();
+            return false;
+        }
+        return true;
+    }
+
+    // Rough per-projectM-frame render-target traffic: projectM writes the source region once and the upscaler
+    // reads it back, then the upscaler writes the output.
+    void LogProjectMTargetTraffic() const {
+        const RenderTargetFormatInfo sourceInfo = GetRenderTargetFormatInfo(projectMSourceFormat_);
+        const RenderTargetFormatInfo outputInfo = GetRenderTargetFormatInfo(projectMOutputFormat_);
+        constexpr double kBytesPerMegabyte = 1024.0 * 1024.0;
+        const double outputBytes =
+            static_cast<double>(projectMOutputWidth_) * static_cast<double>(projectMOutputHeight_) * outputInfo.bytesPerPixel;
+        double trafficBytes = outputBytes;
+        double sourceBytes = 0.0;
+        if (projectMUseUpscaler_) {
+            sourceBytes = static_cast<double>(projectMLowResWidth_) * static_cast<double>(projectMLowResHeight_) *
+                          sourceInfo.bytesPerPixel;
+            trafficBytes += 2.0 * static_cast<double>(projectMViewportWidth_) *
+                            static_cast<double>(projectMViewportHeight_) * sourceInfo.bytesPerPixel;
+        }
+        LOGI("projectM targets: source=%s %.1fMB output=%s %.1fMB x%zu slots, ~%.1fMB target traffic per projectM frame",
+             projectMUseUpscaler_ ? sourceInfo.label : "none",
+             sourceBytes / kBytesPerMegabyte,
+             outputInfo.label,
+             outputBytes / kBytesPerMegabyte,
+             kProjectMOutputSlotCount,
+             trafficBytes / kBytesPerMegabyte);
+    }
+
+    // projectM still has to resize its own buffers to render fewer pixels; only our targets stay allocated.
+    // Render thread only. force applies at once; reallocation uses it because the old viewport may no longer fit
+    // the new source target. Adaptive steps are otherwise gated by ApplyPendingProjectMViewportSize.
+    void SetProjectMViewportSize(int width, int height, bool force = false) {
+        if (width != projectMPendingViewportWidth_ || height != projectMPendingViewportHeight_) {
+            projectMPendingViewportWidth_ = width;
+            projectMPendingViewportHeight_ = height;
+            projectMPendingViewportSinceSeconds_ = ElapsedSeconds();
+        }
+        ApplyPendingProjectMViewportSize(force);
+    }
+
+    // Render thread only. Shrinking applies once the minimum interval since the last resize has passed; growing
+    // also needs the request to have held for kProjectMResizeGrowHoldSeconds, so steps that bounce back and forth
+    // never reach projectM. Each resize logs its own cost and the first frame after it.
+    void ApplyPendingProjectMViewportSize(bool force) {
+        const int width = projectMPendingViewportWidth_;
+        const int height = projectMPendingViewportHeight_;
+        if (width == projectMViewportWidth_ && height == projectMViewportHeight_) {
+            return;
+        }
+        const double nowSeconds = ElapsedSeconds();
+        if (!force && projectMViewportWidth_ > 0) {
+            if (nowSeconds - projectMLastResizeSeconds_ < kProjectMResizeMinIntervalSeconds) {
+                return;
+            }
+            const bool grows = width * height > projectMViewportWidth_ * projectMViewportHeight_;
+            if (grows && nowSeconds - projectMPendingViewportSinceSeconds_ < kProjectMResizeGrowHoldSeconds) {
+                return;
+            }
+        }
+
+        const int fromWidth = projectMViewportWidth_;
+        const int fromHeight = projectMViewportHeight_;
+        projectMViewportWidth_ = width;
+        projectMViewportHeight_ = height;
+        projectMLastResizeSeconds_ = nowSeconds;
+        if (projectM_ != nullptr && fromWidth > 0) {
+            projectMResizeCpuP50Ms_ = ComputePassStats(projectMCpuWindow_).p50Ms;
+            const auto start = std::chrono::steady_clock::now();
+            projectm_set_window_size(projectM_, static_cast<uint32_t>(width), static_cast<uint32_t>(height));
+            projectMResizeSetMs_ =
+                std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+            projectMResizeProbePending_ = true;
+            projectMResizeFromWidth_ = fromWidth;
+            projectMResizeFromHeight_ = fromHeight;
+        } else if (projectM_ != nullptr) {
+            projectm_set_window_size(projectM_, static_cast<uint32_t>(width), static_cast<uint32_t>(height));
+        }
+        ResetProjectMPassSamples();
+    }
+
+    // Render thread only; called with the CPU time of the first frame rendered after a resize.
+    void LogProjectMResizeCost(float firstFrameCpuMs) {
+        if (!projectMResizeProbePending_) {
+            return;
+        }
+        projectMResizeProbePending_ = false;
+        LOGI("projectM resize %d x %d -> %d x %d: set_window_size %.2fms, first frame cpu %.2fms (p50 before %.2fms)",
+             projectMResizeFromWidth_,
+             projectMResizeFromHeight_,
+             projectMViewportWidth_,
+             projectMViewportHeight_,
+             static_cast<double>(projectMResizeSetMs_),
+             static_cast<double>(firstFrameCpuMs),
+             static_cast<double>(projectMResizeCpuP50Ms_));
+    }
+
+    // Render thread only. The next produced frame republishes, so the stale window is replaced promptly.
+    void ResetProjectMPassSamples() {
+        ResetGpuPassSamples(projectMPassTimer_);
+        ResetGpuPassSamples(upscalePassTimer_);
+        projectMCpuWindow_ = PassSampleWindow{};
+        projectMGpuStatsPublishSeconds_ = -1000.0;
+        projectMCpuStatsPublishSeconds_ = -1000.0;
+    }
+
+    // Render thread only.
+    void ApplyProjectMMeshSize(int meshWidth, int meshHeight) {
+        projectm_set_mesh_size(projectM_, static_cast<size_t>(meshWidth), static_cast<size_t>(meshHeight));
+        projectMMeshWidth_ = meshWidth;
+        projectMMeshHeight_ = meshHeight;
+    }
+
+    // Render thread: projectM's CPU time per frame (per-vertex and per-frame equations plus GL submission), tagged
+    // with the mesh size it was measured at.
+    void PublishProjectMCpuStats() {
+        const double nowSeconds = ElapsedSeconds();
+        if (nowSeconds - projectMCpuStatsPublishSeconds_ < kGpuPassStatsPublishSeconds) {
+            return;
+        }
+        projectMCpuStatsPublishSeconds_ = nowSeconds;
+        ProjectMCpuStats stats;
+        stats.render = ComputePassStats(projectMCpuWindow_);
+        stats.meshWidth = projectMMeshWidth_;
+        stats.meshHeight = projectMMeshHeight_;
+        std::lock_guard<std::mutex> lock(gpuPassStatsMutex_);
+        projectMCpuStats_ = stats;
+    }
+
+    // Render thread: fences the projectM pass so a runaway preset is caught from the GPU's side, not just from the
+    // smoothed FPS. The deadline runs from the start of projectm_opengl_render_frame_fbo, so CPU-side stalls in the
+    // equations count too. Only one fence is in flight; a pass still pending when the next frame is due is measured
+    // by that fence alone.
+    void ArmProjectMWatchdog(std::chrono::steady_clock::time_point passStart, float cpuMs) {
+        const float deadlineMs = projectMWatchdogDeadlineMs_.load();
+        if (deadlineMs <= 0.0f || projectMWatchdogFence_ != nullptr) {
+            return;
+        }
+        projectMWatchdogFence_ = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        projectMWatchdogStart_ = passStart;
+        projectMWatchdogOverrun_ = false;
+        if (cpuMs > deadlineMs) {
+            CountProjectMWatchdogOverrun();
+        }
+    }
+
+    // Render thread. Returns true while the fenced pass is still running past the deadline, so no further frame
+    // is queued behind it. A fence found signaled counts as on time even when polled after the deadline.
+    bool PollProjectMWatchdog() {
+        if (projectMWatchdogFence_ == nullptr) {
+            return false;
+        }
+        if (glClientWaitSync(projectMWatchdogFence_, GL_SYNC_FLUSH_COMMANDS_BIT, 0) != GL_TIMEOUT_EXPIRED) {
+            glDeleteSync(projectMWatchdogFence_);
+            projectMWatchdogFence_ = nullptr;
+            if (!projectMWatchdogOverrun_) {
+                projectMWatchdogStreak_.store(0);
+            }
+            return false;
+        }
+        const float deadlineMs = projectMWatchdogDeadlineMs_.load();
+        const float elapsedMs =
+            std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - projectMWatchdogStart_).count();
+        if (deadlineMs <= 0.0f || elapsedMs <= deadlineMs) {
+            return false;
+        }
+        CountProjectMWatchdogOverrun();
         return true;
     }
 
-    void RenderSgsrUpscalePass() {
-        if (!projectMUseUpscaler_ || projectMUpscaleFbo_ == 0 || projectMLowResTexture_ == 0 ||
-            sgsrProgram_ == 0 || sgsrVao_ == 0 || projectMRenderWidth_ <= 0 || projectMRenderHeight_ <= 0) {
+    void CountProjectMWatchdogOverrun() {
+        if (projectMWatchdogOverrun_) {
+            return;
+        }
+        projectMWatchdogOverrun_ = true;
+        ++projectMWatchdogStreak_;
+        ++projectMWatchdogOverruns_;
+    }
+
+    // Render thread only.
+    void ResetProjectMWatchdog() {
+        if (projectMWatchdogFence_ != nullptr) {
+            glDeleteSync(projectMWatchdogFence_);
+            projectMWatchdogFence_ = nullptr;
+        }
+        projectMWatchdogOverrun_ = false;
+        projectMWatchdogStreak_.store(0);
+    }
+
+    ProjectMCpuStats SnapshotProjectMCpuStats() const {
+        std::lock_guard<std::mutex> lock(gpuPassStatsMutex_);
+        return projectMCpuStats_;
+    }
+
+    void RenderSgsrUpscalePass(GLuint targetFramebuffer) {
+        if (!projectMUseUpscaler_ || targetFramebuffer == 0 || projectMLowResTexture_ == 0 ||
+            sgsrProgram_ == 0 || sgsrVao_ == 0 || projectMViewportWidth_ <= 0 || projectMViewportHeight_ <= 0 ||
+            projectMLowResWidth_ <= 0 || projectMLowResHeight_ <= 0) {
             return;
         }
 
-        glBindFramebuffer(GL_FRAMEBUFFER, projectMUpscaleFbo_);
+        const float sourceWidth = static_cast<float>(projectMLowResWidth_);
+        const float sourceHeight = static_cast<float>(projectMLowResHeight_);
+        glBindFramebuffer(GL_FRAMEBUFFER, targetFramebuffer);
         glViewport(0, 0, static_cast<GLsizei>(projectMOutputWidth_), static_cast<GLsizei>(projectMOutputHeight_));
         glDisable(GL_BLEND);
         glUseProgram(sgsrProgram_);
         glUniform4f(sgsrViewportInfoLoc_,
-                    1.0f / static_cast<float>(projectMRenderWidth_),
-                    1.0f / static_cast<float>(projectMRenderHeight_),
-                    static_cast<float>(projectMRenderWidth_),
-                    static_cast<float>(projectMRenderHeight_));
+                    1.0f / sourceWidth,
+                    1.0f / sourceHeight,
+                    sourceWidth,
+                    sourceHeight);
+        glUniform4f(sgsrSourceRectLoc_,
+                    static_cast<float>(projectMViewportWidth_) / sourceWidth,
+                    static_cast<float>(projectMViewportHeight_) / sourceHeight,
+                    static_cast<float>(projectMViewportWidth_ - 1) / sourceWidth,
+                    static_cast<float>(projectMViewportHeight_ - 1) / sourceHeight);
         glActiveTexture(GL_TEXTURE0);
         glBindTexture(GL_TEXTURE_2D, projectMLowResTexture_);
         glUniform1i(sgsrSamplerLoc_, 0);
@@ -2664,6 +5369,34 @@ private:
         glBindFramebuffer(GL_FRAMEBUFFER, 0);
     }
 
+    float MinProjectMRenderScale() const {
+        return kMinProjectMRenderScale;
+    }
+
+    XrExtent2Di EyeBufferRectExtent(const XrSwapchainBundle& swapchain) const {
+        const float scale = std::clamp(eyeBufferAdaptiveScale_, kMinEyeBufferScale, eyeBufferMaxScale_);
+        const int32_t minWidth = std::min(swapchain.width, kMinEyeBufferDimension);
+        const int32_t minHeight = std::min(swapchain.height, kMinEyeBufferDimension);
+        XrExtent2Di extent{};
+        extent.width = std::clamp(static_cast<int32_t>(std::lround(swapchain.recommendedWidth * scale)),
+                                  minWidth,
+                                  swapchain.width);
+        extent.height = std::clamp(static_cast<int32_t>(std::lround(swapchain.recommendedHeight * scale)),
+                                   minHeight,
+                                   swapchain.height);
+        return extent;
+    }
+
+    // The shrunk rect is centered in the swapchain image so its middle stays on the lens center, where the
+    // foveation profile keeps full resolution.
+    XrRect2Di EyeBufferRect(const XrSwapchainBundle& swapchain) const {
+        XrRect2Di rect{};
+        rect.extent = EyeBufferRectExtent(swapchain);
+        rect.offset.x = (swapchain.width - rect.extent.width) / 2;
+        rect.offset.y = (swapchain.height - rect.extent.height) / 2;
+        return rect;
+    }
+
     float EffectiveProjectMRenderScale() const {
         if (projectMOutputWidth_ == 0) {
             return 1.0f;
@@ -2731,7 +5464,15 @@ private:
         return GetSelectablePresetCountCached(false, true) > 0;
     }
 
+    bool IsPresetQuarantined(const std::string& presetPath) const {
+        const std::string key = PresetHistoryKey(presetPath);
+        return std::find(quarantinedPresets_.begin(), quarantinedPresets_.end(), key) != quarantinedPresets_.end();
+    }
+
     bool IsPresetSelectable(const std::string& presetPath, bool skipMarked, bool favoritesOnly) const {
+        if (IsPresetQuarantined(presetPath)) {
+            return false;
+        }
         if (favoritesOnly && !IsPresetFavorited(presetPath)) {
             return false;
         }
@@ -2816,6 +5557,97 @@ private:
         }
     }
 
+    // Machine-readable copy of the per-pass GPU stats, rewritten with every Render stats line. Only the text is
+    // built here; the file write thread replaces the file.
+    void WriteGpuPassStatsDump(const std::array<GpuPassStats, kGpuPassCount>& stats, double smoothedFps) {
+        if (gpuStatsFilePath_.empty()) {
+            return;
+        }
+        std::string json;
+        char line[160] = {};
+        std::snprintf(line,
+                      sizeof(line),
+                      "{\n  \"uptime_s\": %.1f,\n  \"fps\": %.2f,\n  \"refresh_hz\": %.0f,\n  \"render_scale\": %.3f,\n",
+                      ElapsedSeconds(),
+                      smoothedFps,
+                      static_cast<double>(activeDisplayRefreshRate_),
+                      static_cast<double>(EffectiveProjectMRenderScale()));
+        json += line;
+        json += "  \"passes\": {";
+        for (size_t i = 0; i < kGpuPassCount; ++i) {
+            const GpuPassStats& pass = stats[i];
+            std::snprintf(line,
+                          sizeof(line),
+                          "%s\n    \"%s\": {\"avg_ms\": %.3f, \"p50_ms\": %.3f, \"p95_ms\": %.3f, \"max_ms\": %.3f, \"stddev_ms\": %.3f, \"samples\": %u}",
+                          i == 0 ? "" : ",",
+                          GpuPassLabel(static_cast<GpuPass>(i)),
+                          static_cast<double>(pass.avgMs),
+                          static_cast<double>(pass.p50Ms),
+                          static_cast<double>(pass.p95Ms),
+                          static_cast<double>(pass.maxMs),
+                          static_cast<double>(pass.stddevMs),
+                          pass.samples);
+            json += line;
+        }
+        json += "\n  }\n}\n";
+        QueueFileWrite(gpuStatsFilePath_, std::move(json));
+    }
+
+    // Hands a whole-file rewrite to the file write thread so the render thread never opens, writes or renames
+    // files. A newer write to a path that is still queued replaces the queued contents.
+    void QueueFileWrite(const std::string& path, std::string contents) {
+        if (path.empty()) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(fileWriteMutex_);
+            const auto queued = std::find_if(fileWriteJobs_.begin(),
+                                             fileWriteJobs_.end(),
+                                             [&path](const FileWriteJob& job) { return job.path == path; });
+            if (queued != fileWriteJobs_.end()) {
+                queued->contents = std::move(contents);
+            } else {
+                fileWriteJobs_.push_back({path, std::move(contents)});
+            }
+        }
+        if (!fileWriteThread_.joinable()) {
+            fileWriteThreadStop_ = false;
+            fileWriteThread_ = std::thread([this]() { FileWriteThreadMain(); });
+        }
+        fileWriteCondition_.notify_one();
+    }
+
+    // Drains the queue before joining, so writes queued at shutdown still land.
+    void StopFileWriteThread() {
+        if (!fileWriteThread_.joinable()) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(fileWriteMutex_);
+            fileWriteThreadStop_ = true;
+        }
+        fileWriteCondition_.notify_all();
+        fileWriteThread_.join();
+    }
+
+    void FileWriteThreadMain() {
+        for (;;) {
+            FileWriteJob job;
+            {
+                std::unique_lock<std::mutex> lock(fileWriteMutex_);
+                fileWriteCondition_.wait(lock, [this]() { return fileWriteThreadStop_ || !fileWriteJobs_.empty(); });
+                if (fileWriteJobs_.empty()) {
+                    return;
+                }
+                job = std::move(fileWriteJobs_.front());
+                fileWriteJobs_.pop_front();
+            }
+            if (!WriteFileReplacing(job.path, job.contents)) {
+                LOGW("Could not write %s", job.path.c_str());
+            }
+        }
+    }
+
     void LoadSlowPresetList() {
         slowPresets_.clear();
         InvalidateSelectablePresetCountCache();
@@ -2847,37 +5679,304 @@ private:
             }
         }
 
-        if (!slowPresets_.empty()) {
-            LOGI("Loaded %zu marked slow presets.", slowPresets_.size());
+        if (!slowPresets_.empty()) {
+            LOGI("Loaded %zu marked slow presets.", slowPresets_.size());
+        }
+    }
+
+    void LoadFavoritePresetList() {
+        favoritePresets_.clear();
+        InvalidateSelectablePresetCountCache();
+        if (favoritePresetFilePath_.empty()) {
+            return;
+        }
+
+        std::ifstream in(favoritePresetFilePath_);
+        if (!in) {
+            return;
+        }
+
+        std::string line;
+        while (std::getline(in, line)) {
+            line = TrimAscii(line);
+            if (line.empty() || line[0] == '#') {
+                continue;
+            }
+            if (std::find(favoritePresets_.begin(), favoritePresets_.end(), line) == favoritePresets_.end()) {
+                favoritePresets_.push_back(line);
+            }
+        }
+
+        if (!favoritePresets_.empty()) {
+            LOGI("Loaded %zu favorited presets.", favoritePresets_.size());
+        }
+    }
+
+    // One "<preset key>\t<width>x<height>" line per preset that settled below its cap mesh.
+    void LoadPresetMeshSizes() {
+        presetMeshSizes_.clear();
+        if (presetMeshFilePath_.empty()) {
+            return;
+        }
+
+        std::ifstream in(presetMeshFilePath_);
+        if (!in) {
+            return;
+        }
+
+        std::string line;
+        while (std::getline(in, line)) {
+            line = TrimAscii(line);
+            const size_t tab = line.rfind('\t');
+            if (line.empty() || line[0] == '#' || tab == std::string::npos) {
+                continue;
+            }
+            int meshWidth = 0;
+            int meshHeight = 0;
+            if (ParseIntPairText(line.substr(tab + 1), meshWidth, meshHeight) && meshWidth > 0 && meshHeight > 0) {
+                presetMeshSizes_[TrimAscii(line.substr(0, tab))] = {meshWidth, meshHeight};
+            }
+        }
+
+        if (!presetMeshSizes_.empty()) {
+            LOGI("Loaded %zu per-preset mesh sizes.", presetMeshSizes_.size());
+        }
+    }
+
+    void PersistPresetMeshSizes() const {
+        if (presetMeshFilePath_.empty()) {
+            return;
+        }
+
+        // Written beside the file and renamed over it, so a crash mid-write never leaves a truncated list.
+        const std::string tempPath = presetMeshFilePath_ + ".tmp";
+        {
+            std::ofstream out(tempPath, std::ios::trunc);
+            if (!out) {
+                LOGW("Could not write preset mesh sizes: %s", tempPath.c_str());
+                return;
+            }
+
+            for (const auto& entry : presetMeshSizes_) {
+                out << entry.first << '\t' << entry.second.first << 'x' << entry.second.second << '\n';
+            }
+        }
+        if (std::rename(tempPath.c_str(), presetMeshFilePath_.c_str()) != 0) {
+            LOGW("Could not replace preset mesh sizes: %s", presetMeshFilePath_.c_str());
+        }
+    }
+
+    // One "<preset key>\t<projectM pass p95 ms per megapixel>" line per preset measured after its blend.
+    void LoadPresetGpuCosts() {
+        presetGpuCosts_.clear();
+        if (presetGpuCostFilePath_.empty()) {
+            return;
+        }
+
+        std::ifstream in(presetGpuCostFilePath_);
+        if (!in) {
+            return;
+        }
+
+        std::string line;
+        while (std::getline(in, line)) {
+            line = TrimAscii(line);
+            const size_t tab = line.rfind('\t');
+            if (line.empty() || line[0] == '#' || tab == std::string::npos) {
+                continue;
+            }
+            float msPerMegapixel = 0.0f;
+            if (ParseFloatText(line.substr(tab + 1), msPerMegapixel) && msPerMegapixel > 0.0f) {
+                presetGpuCosts_[TrimAscii(line.substr(0, tab))] = msPerMegapixel;
+            }
+        }
+
+        if (!presetGpuCosts_.empty()) {
+            LOGI("Loaded %zu per-preset GPU costs.", presetGpuCosts_.size());
+        }
+    }
+
+    // One "render_scale/mesh/foveation/refresh_hz" rung per line, best-looking first. Property values
+    // are capped at 91 characters, so ladders longer than about three rungs live here instead of perf.ladder.
+    void LoadQualityLadderFile() {
+        qualityLadderFileText_.clear();
+        if (qualityLadderFilePath_.empty()) {
+            return;
+        }
+
+        std::ifstream in(qualityLadderFilePath_);
+        if (!in) {
+            return;
+        }
+
+        std::string line;
+        while (std::getline(in, line)) {
+            line = TrimAscii(line);
+            if (line.empty() || line[0] == '#') {
+                continue;
+            }
+            if (!qualityLadderFileText_.empty()) {
+                qualityLadderFileText_ += ';';
+            }
+            qualityLadderFileText_ += line;
+        }
+
+        if (!qualityLadderFileText_.empty()) {
+            LOGI("Loaded quality ladder from %s", qualityLadderFilePath_.c_str());
+        }
+    }
+
+    // "renderer<TAB>format" from a finished format probe. A different GPU or driver string probes again.
+    void LoadRenderTargetFormatFile() {
+        formatProbePending_ = true;
+        if (renderTargetFormatFilePath_.empty()) {
+            return;
+        }
+
+        std::ifstream in(renderTargetFormatFilePath_);
+        std::string line;
+        if (!in || !std::getline(in, line)) {
+            return;
+        }
+        const size_t tab = line.find('\t');
+        if (tab == std::string::npos || line.substr(0, tab) != glRendererName_) {
+            return;
+        }
+        RenderTargetFormat format = RenderTargetFormat::Auto;
+        if (!ParseRenderTargetFormatText(TrimAscii(line.substr(tab + 1)), format) ||
+            format == RenderTargetFormat::Auto) {
+            return;
+        }
+        autoRenderTargetFormat_ = format;
+        formatProbePending_ = false;
+        LOGI("Auto render-target format: %s (probed earlier on this GPU)", GetRenderTargetFormatInfo(format).label);
+    }
+
+    std::vector<RenderTargetFormat> FormatProbeCandidates() const {
+        // RGB565 is left out: it bands on projectM's gradients, so Auto never picks it whatever it costs.
+        std::vector<RenderTargetFormat> candidates{RenderTargetFormat::Rgba8, RenderTargetFormat::Rgb10A2};
+        if (colorBufferFloatSupported_) {
+            candidates.push_back(RenderTargetFormat::R11G11B10F);
+        }
+        return candidates;
+    }
+
+    // A/B of the formats Auto may use: each candidate renders the same preset for a full GPU sample window, and
+    // the projectM plus SGSR pass p50 is compared against RGBA8. A preset switch restarts the probe so every
+    // candidate is timed on the same content. Returns true while a candidate is being measured, which holds the
+    // other performance levers so they don't change the workload under the probe.
+    bool UpdateRenderTargetFormatProbe(double nowSeconds) {
+        if (!formatProbePending_) {
+            return false;
+        }
+        if (glGetQueryObjectui64vEXT_ == nullptr) {
+            formatProbePending_ = false;
+            LOGI("Auto render-target format: RGBA8 (no GPU timers to probe with)");
+            return false;
+        }
+        if (projectM_ == nullptr ||
+            (sourceFormatSetting_ != RenderTargetFormat::Auto && outputFormatSetting_ != RenderTargetFormat::Auto)) {
+            return false;
+        }
+
+        const std::vector<RenderTargetFormat> candidates = FormatProbeCandidates();
+        if (formatProbeCostsMs_.size() != candidates.size() || formatProbePresetIndex_ != currentPresetIndex_) {
+            formatProbeCostsMs_.assign(candidates.size(), -1.0f);
+            formatProbeIndex_ = 0;
+            formatProbeStartSeconds_ = -1.0;
+            formatProbePresetIndex_ = currentPresetIndex_;
+        }
+        if (formatProbeStartSeconds_ < 0.0) {
+            autoRenderTargetFormat_ = candidates[formatProbeIndex_];
+            if (!ApplyProjectMRenderConfiguration()) {
+                LOGE("Failed to apply render-target format %s for the probe.",
+                     GetRenderTargetFormatInfo(autoRenderTargetFormat_).label);
+                exitRenderLoop_ = true;
+                return true;
+            }
+            formatProbeStartSeconds_ = nowSeconds;
+            return true;
+        }
+
+        // Reallocation resets the projectM and upscale windows, so a full window only holds this candidate.
+        const std::array<GpuPassStats, kGpuPassCount> gpuPassStats = SnapshotGpuPassStats();
+        const GpuPassStats& projectMGpu = gpuPassStats[static_cast<size_t>(GpuPass::ProjectM)];
+        const GpuPassStats& upscaleGpu = gpuPassStats[static_cast<size_t>(GpuPass::Upscale)];
+        const bool timedOut = nowSeconds - formatProbeStartSeconds_ >= kFormatProbeCandidateTimeoutSeconds;
+        if (projectMGpu.samples < kGpuPassSampleWindow && !timedOut) {
+            return true;
         }
+        const RenderTargetFormat candidate = candidates[formatProbeIndex_];
+        if (projectMGpu.samples >= kGpuPassSampleWindow) {
+            formatProbeCostsMs_[formatProbeIndex_] =
+                projectMGpu.p50Ms + (projectMUseUpscaler_ ? upscaleGpu.p50Ms : 0.0f);
+            LOGI("Format probe %s: projectM p50=%.2fms p95=%.2fms, upscale p50=%.2fms p95=%.2fms (%u samples)",
+                 GetRenderTargetFormatInfo(candidate).label,
+                 static_cast<double>(projectMGpu.p50Ms),
+                 static_cast<double>(projectMGpu.p95Ms),
+                 static_cast<double>(upscaleGpu.p50Ms),
+                 static_cast<double>(upscaleGpu.p95Ms),
+                 projectMGpu.samples);
+        } else {
+            LOGW("Format probe %s: timed out after %u samples.", GetRenderTargetFormatInfo(candidate).label,
+                 projectMGpu.samples);
+        }
+        ++formatProbeIndex_;
+        formatProbeStartSeconds_ = -1.0;
+        if (formatProbeIndex_ < candidates.size()) {
+            return true;
+        }
+
+        FinishRenderTargetFormatProbe(candidates);
+        return false;
     }
 
-    void LoadFavoritePresetList() {
-        favoritePresets_.clear();
-        InvalidateSelectablePresetCountCache();
-        if (favoritePresetFilePath_.empty()) {
-            return;
+    void FinishRenderTargetFormatProbe(const std::vector<RenderTargetFormat>& candidates) {
+        formatProbePending_ = false;
+        const float baselineMs = formatProbeCostsMs_[0];
+        size_t best = 0;
+        std::string summary;
+        for (size_t i = 0; i < candidates.size(); ++i) {
+            const float costMs = formatProbeCostsMs_[i];
+            char entry[64];
+            std::snprintf(entry, sizeof(entry), "%s%s=%.2fms", summary.empty() ? "" : " ",
+                          GetRenderTargetFormatInfo(candidates[i]).label, static_cast<double>(costMs));
+            summary += entry;
+            if (i > 0 && baselineMs > 0.0f && costMs > 0.0f && costMs < baselineMs * (1.0f - kFormatProbeMinGain) &&
+                costMs < formatProbeCostsMs_[best]) {
+                best = i;
+            }
         }
-
-        std::ifstream in(favoritePresetFilePath_);
-        if (!in) {
+        autoRenderTargetFormat_ = candidates[best];
+        const char* bestLabel = GetRenderTargetFormatInfo(autoRenderTargetFormat_).label;
+        LOGI("Format probe (projectM+upscale p50): %s -> auto=%s", summary.c_str(), bestLabel);
+        if (!ApplyProjectMRenderConfiguration()) {
+            LOGE("Failed to apply probed render-target format %s.", bestLabel);
+            exitRenderLoop_ = true;
             return;
         }
+        // A probe without an RGBA8 baseline decided nothing; it runs again next launch.
+        if (baselineMs > 0.0f && !renderTargetFormatFilePath_.empty()) {
+            QueueFileWrite(renderTargetFormatFilePath_, glRendererName_ + "\t" + bestLabel + "\n");
+        }
+    }
 
-        std::string line;
-        while (std::getline(in, line)) {
-            line = TrimAscii(line);
-            if (line.empty() || line[0] == '#') {
-                continue;
-            }
-            if (std::find(favoritePresets_.begin(), favoritePresets_.end(), line) == favoritePresets_.end()) {
-                favoritePresets_.push_back(line);
-            }
+    // Costs change on every preset switch, so they are written with the stats log and when the app pauses or
+    // stops rather than per switch, and always through the file write thread.
+    void FlushPresetGpuCosts() {
+        if (!presetGpuCostsDirty_ || presetGpuCostFilePath_.empty()) {
+            return;
         }
+        presetGpuCostsDirty_ = false;
 
-        if (!favoritePresets_.empty()) {
-            LOGI("Loaded %zu favorited presets.", favoritePresets_.size());
+        std::string text;
+        char value[32] = {};
+        for (const auto& entry : presetGpuCosts_) {
+            std::snprintf(value, sizeof(value), "\t%g\n", static_cast<double>(entry.second));
+            text += entry.first;
+            text += value;
         }
+        QueueFileWrite(presetGpuCostFilePath_, std::move(text));
     }
 
     bool ToggleCurrentPresetFavorite() {
@@ -2914,19 +6013,16 @@ private:
             }
         }
 
-        hudTextDirty_ = true;
         return !currentlyFavorited;
     }
 
     FavoritesOnlyFilterToggleResult ToggleFavoritesOnlyFilter() {
         if (favoritesOnlyMode_) {
             favoritesOnlyMode_ = false;
-            hudTextDirty_ = true;
             return FavoritesOnlyFilterToggleResult::Disabled;
         }
 
         if (!HasAnyFavoritedPresetsInLibrary()) {
-            hudTextDirty_ = true;
             return FavoritesOnlyFilterToggleResult::NoFavorites;
         }
 
@@ -2934,20 +6030,17 @@ private:
         if (!IsCurrentPresetFavorited()) {
             SwitchPresetRelative(+1, true);
         }
-        hudTextDirty_ = true;
         return FavoritesOnlyFilterToggleResult::Enabled;
     }
 
     bool TogglePresetLock() {
         lockCurrentPreset_ = !lockCurrentPreset_;
         lowFpsSinceSeconds_ = -1.0;
-        hudTextDirty_ = true;
         return lockCurrentPreset_;
     }
 
     bool ToggleUtilityPanel() {
         hudUtilityPanelOpen_ = !hudUtilityPanelOpen_;
-        hudTextDirty_ = true;
         return hudUtilityPanelOpen_;
     }
 
@@ -2972,6 +6065,9 @@ private:
 
         for (size_t i = 0; i < slowPresets_.size(); ++i) {
             const std::string key = PresetHistoryKey(slowPresets_[i]);
+            if (IsPresetQuarantined(slowPresets_[i])) {
+                continue;
+            }
             auto eligibleIt = slowPresetRetryEligibleAfterSeconds_.find(key);
             if (eligibleIt == slowPresetRetryEligibleAfterSeconds_.end()) {
                 slowPresetRetryEligibleAfterSeconds_[key] = nowSeconds + perfSlowPresetRetryCooldownSeconds_;
@@ -3027,6 +6123,7 @@ private:
 
     void ClearSlowPresetMarks() {
         slowPresets_.clear();
+        quarantinedPresets_.clear();
         PersistSlowPresetList();
         InvalidateSelectablePresetCountCache();
         slowPresetFailureCounts_.clear();
@@ -3108,7 +6205,7 @@ private:
             audioFrameScratch_[2 * i + 1] = sample;
         }
 
-        projectm_pcm_add_float(projectM_, audioFrameScratch_.data(), frameCount, PROJECTM_STEREO);
+        SubmitPcmToProjectM(audioFrameScratch_.data(), frameCount);
     }
 
     void AddAudioForFrame(double nowSeconds, float deltaSeconds) {
@@ -3125,14 +6222,11 @@ private:
         audioFrameScratch_.assign(static_cast<size_t>(framesToPull) * 2, 0.0f);
         const size_t queuedFrames = DequeueAudioFrames(audioFrameScratch_.data(), framesToPull);
         if (queuedFrames > 0) {
-            projectm_pcm_add_float(projectM_, audioFrameScratch_.data(), static_cast<unsigned int>(queuedFrames), PROJECTM_STEREO);
+            SubmitPcmToProjectM(audioFrameScratch_.data(), queuedFrames);
             lastExternalAudioSeconds_ = nowSeconds;
         }
 
         if (nowSeconds - lastExternalAudioSeconds_ > kAudioFallbackDelaySeconds) {
-            if (currentAudioMode_ != AudioMode::Synthetic || currentMediaPlaying_) {
-                hudTextDirty_ = true;
-            }
             AddSyntheticAudioForFrame(targetFrames);
             currentAudioMode_ = AudioMode::Synthetic;
             currentMediaPlaying_ = false;
@@ -3174,7 +6268,6 @@ private:
 
         if (favoritesOnlyMode_ && !HasAnyFavoritedPresetsInLibrary()) {
             favoritesOnlyMode_ = false;
-            hudTextDirty_ = true;
             LOGI("Disabled favorites-only filter: no favorites found in current preset list.");
         }
 
@@ -3194,17 +6287,15 @@ private:
         }
 
         if (usingFallbackPreset_) {
-            projectm_load_preset_file(projectM_, presetFiles_[currentPresetIndex_].c_str(), false);
+            LoadProjectMPresetFile(presetFiles_[currentPresetIndex_], 0.0);
             usingFallbackPreset_ = false;
             currentPresetLabel_ = BuildPresetDisplayLabel(presetFiles_[currentPresetIndex_]);
-            hudTextDirty_ = true;
         }
 
         if (!presetFiles_.empty() && currentPresetIndex_ < presetFiles_.size()) {
             const std::string updated = BuildPresetDisplayLabel(presetFiles_[currentPresetIndex_]);
             if (updated != currentPresetLabel_) {
                 currentPresetLabel_ = updated;
-                hudTextDirty_ = true;
             }
         }
 
@@ -3215,10 +6306,10 @@ private:
         if (presetFiles_.empty() || projectM_ == nullptr) {
             return;
         }
+        watchdogResumeSeconds_ = -1.0;
 
         if (favoritesOnlyMode_ && !HasAnyFavoritedPresetsInLibrary()) {
             favoritesOnlyMode_ = false;
-            hudTextDirty_ = true;
             LOGI("Disabled favorites-only filter: no favorites available for switching.");
         }
 
@@ -3231,11 +6322,266 @@ private:
             }
         }
 
+        const double nowSeconds = ElapsedSeconds();
+        RecordPresetGpuCost(nowSeconds);
         currentPresetIndex_ = nextIndex;
-        projectm_load_preset_file(projectM_, presetFiles_[currentPresetIndex_].c_str(), smooth);
-        lastPresetSwitchSeconds_ = ElapsedSeconds();
+        RequestPerformanceBoost(kPerfBoostAfterPresetSwitchSeconds);
+        presetBlendSeconds_ = BeginPresetTransition(presetFiles_[currentPresetIndex_], smooth);
+        LoadProjectMPresetFile(presetFiles_[currentPresetIndex_], presetBlendSeconds_);
+        ApplyPresetCadenceLevel();
+        usingFallbackPreset_ = false;
+        lastPresetSwitchSeconds_ = nowSeconds;
         currentPresetLabel_ = BuildPresetDisplayLabel(presetFiles_[currentPresetIndex_]);
-        hudTextDirty_ = true;
+    }
+
+    double GpuFrameBudgetMs() const {
+        const double frameMs =
+            (spaceWarpSubmitting_ ? 2000.0 : 1000.0) / std::max(static_cast<double>(activeDisplayRefreshRate_), 1.0);
+        return frameMs * static_cast<double>(perfGpuBudgetFraction_);
+    }
+
+    // The grace exists to sit out the blend, so a shorter blend or a cut shortens it by the same amount.
+    double PerfGraceAfterPresetSwitchSeconds() const {
+        return kPerfGraceAfterPresetSwitchSeconds - (kPresetBlendSeconds - presetBlendSeconds_);
+    }
+
+    // Runs before the switch: the outgoing preset's projectM pass p95, once the window no longer holds blend
+    // frames, becomes its cost. Stored per megapixel so it carries across render scales and rungs.
+    void RecordPresetGpuCost(double nowSeconds) {
+        if (usingFallbackPreset_ || glGetQueryObjectui64vEXT_ == nullptr || currentPresetIndex_ >= presetFiles_.size()) {
+            return;
+        }
+        const double windowSeconds =
+            static_cast<double>(kGpuPassSampleWindow) / std::max(static_cast<double>(activeDisplayRefreshRate_), 1.0);
+        if (nowSeconds - lastPresetSwitchSeconds_ < presetBlendSeconds_ + windowSeconds) {
+            return;
+        }
+        const GpuPassStats projectMGpu = SnapshotGpuPassStats()[static_cast<size_t>(GpuPass::ProjectM)];
+        if (projectMGpu.samples < kGpuScaleMinSamples || projectMGpu.renderPixels == 0) {
+            return;
+        }
+
+        const float msPerMegapixel = projectMGpu.p95Ms / (static_cast<float>(projectMGpu.renderPixels) / 1.0e6f);
+        const auto inserted = presetGpuCosts_.emplace(PresetHistoryKey(presetFiles_[currentPresetIndex_]), msPerMegapixel);
+        if (!inserted.second) {
+            float& cost = inserted.first->second;
+            cost += (msPerMegapixel - cost) * kPresetGpuCostLearnRate;
+        }
+        presetGpuCostsDirty_ = true;
+    }
+
+    // Picks the transition into the next preset, starting a snapshot crossfade if that is the choice, and returns
+    // projectM's blend length (0 is a hard cut). During a blend projectM renders both presets, so the predicted
+    // frame is the other passes plus the outgoing preset's measured projectM time plus the incoming preset's
+    // recorded cost at the current render size. An unmeasured preset is assumed to cost the same as the outgoing
+    // one. Must run before the load is posted, while the display texture still holds the outgoing preset.
+    double BeginPresetTransition(const std::string& presetPath, bool smooth) {
+        if (!smooth || presetTransitionMode_ == PresetTransitionMode::Cut) {
+            return 0.0;
+        }
+        if (presetTransitionMode_ == PresetTransitionMode::Smooth) {
+            return kPresetBlendSeconds;
+        }
+        if (presetTransitionMode_ == PresetTransitionMode::Snapshot) {
+            return StartSnapshotCrossfade() ? 0.0 : kPresetBlendSeconds;
+        }
+
+        const std::array<GpuPassStats, kGpuPassCount> stats = SnapshotGpuPassStats();
+        const GpuPassStats& projectMGpu = stats[static_cast<size_t>(GpuPass::ProjectM)];
+        const GpuPassStats& eyeGpu = stats[static_cast<size_t>(GpuPass::Eye)];
+        const uint32_t renderPixels = static_cast<uint32_t>(projectMRenderWidth_ * projectMRenderHeight_);
+        const bool measured = glGetQueryObjectui64vEXT_ != nullptr &&
+                              projectMGpu.samples >= kGpuScaleMinSamples &&
+                              projectMGpu.renderPixels == renderPixels &&
+                              eyeGpu.samples > 0;
+        if (!measured) {
+            LOGI("Preset transition: blend %.1fs (no GPU timing)", kPresetBlendSeconds);
+            return kPresetBlendSeconds;
+        }
+
+        const double cadenceRatio =
+            static_cast<double>(kProjectMCadenceRatios[static_cast<size_t>(projectMCadenceLevel_)]);
+        const double viewCount = static_cast<double>(std::max<size_t>(xrViews_.size(), 1));
+        const double otherMs =
+            viewCount * static_cast<double>(eyeGpu.avgMs +
+                                            stats[static_cast<size_t>(GpuPass::Hud)].avgMs +
+                                            stats[static_cast<size_t>(GpuPass::Hands)].avgMs) +
+            (projectMUseUpscaler_ ? cadenceRatio * static_cast<double>(stats[static_cast<size_t>(GpuPass::Upscale)].p95Ms)
+                                  : 0.0);
+        const double outgoingMs = static_cast<double>(projectMGpu.p95Ms);
+        const auto known = presetGpuCosts_.find(PresetHistoryKey(presetPath));
+        const double incomingMs = known != presetGpuCosts_.end()
+                                      ? static_cast<double>(known->second) * static_cast<double>(renderPixels) / 1.0e6
+                                      : outgoingMs;
+        const double blendMs = otherMs + cadenceRatio * (outgoingMs + incomingMs);
+        const double budgetMs = GpuFrameBudgetMs();
+
+        double blendSeconds = 0.0;
+        const char* choice = "cut";
+        if (blendMs <= budgetMs) {
+            blendSeconds = kPresetBlendSeconds;
+            choice = "blend";
+        } else if (StartSnapshotCrossfade()) {
+            choice = "snapshot";
+        } else if (blendMs <= budgetMs * kPresetShortBlendMaxOverrun) {
+            blendSeconds = kPresetShortBlendSeconds;
+            choice = "short blend";
+        }
+        LOGI("Preset transition: %s %.1fs predicted %.2fms (other %.2f + projectM out %.2f in %.2f%s), budget %.2fms",
+             choice,
+             blendSeconds,
+             blendMs,
+             otherMs,
+             outgoingMs,
+             incomingMs,
+             known != presetGpuCosts_.end() ? "" : " assumed",
+             budgetMs);
+        return blendSeconds;
+    }
+
+    // Copies the displayed projectM output into the snapshot target; the scene pass then fades from it to the live
+    // output, so only the incoming preset is rendered. The copy runs on the main context, which owns the snapshot
+    // and its framebuffers (framebuffers are not shared with the projectM thread's context).
+    bool StartSnapshotCrossfade() {
+        if (projectMTexture_ == 0 || projectMOutputWidth_ == 0 || projectMOutputHeight_ == 0) {
+            return false;
+        }
+        const int width = static_cast<int>(projectMOutputWidth_);
+        const int height = static_cast<int>(projectMOutputHeight_);
+        if (projectMSnapshotTexture_ != 0 &&
+            (projectMSnapshotWidth_ != width || projectMSnapshotHeight_ != height ||
+             projectMSnapshotFormat_ != projectMOutputFormat_)) {
+            DestroyProjectMSnapshot();
+        }
+        if (projectMSnapshotTexture_ == 0) {
+            if (!CreateColorTexture(projectMSnapshotTexture_, width, height, projectMOutputFormat_)) {
+                return false;
+            }
+            if (!BuildFramebuffer(projectMSnapshotFramebuffer_, projectMSnapshotTexture_)) {
+                glDeleteTextures(1, &projectMSnapshotTexture_);
+                projectMSnapshotTexture_ = 0;
+                return false;
+            }
+            projectMSnapshotWidth_ = width;
+            projectMSnapshotHeight_ = height;
+            projectMSnapshotFormat_ = projectMOutputFormat_;
+        }
+        if (projectMSnapshotReadFramebuffer_ == 0) {
+            glGenFramebuffers(1, &projectMSnapshotReadFramebuffer_);
+        }
+
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, projectMSnapshotReadFramebuffer_);
+        glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, projectMTexture_, 0);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, projectMSnapshotFramebuffer_);
+        glBlitFramebuffer(0, 0, width, height, 0, 0, width, height, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+        // The output slot goes back to the projectM thread; don't keep it attached here.
+        glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0);
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+
+        // Callers load the incoming preset right after this, so its frames carry the next generation.
+        projectMSnapshotPresetGeneration_ = projectMRequestedPresetGeneration_ + 1;
+        projectMSnapshotRequestSeconds_ = ElapsedSeconds();
+        projectMSnapshotStartSeconds_ = -1.0;
+        projectMSnapshotFade_ = 0.0f;
+        return true;
+    }
+
+    // The fade clock starts when the incoming preset's first frame is displayed. Until then the outgoing preset's
+    // frames still in the ring would only blend the snapshot with itself, and the new preset would pop in mid-fade.
+    void UpdateSnapshotCrossfade(double nowSeconds) {
+        if (projectMSnapshotFade_ >= 1.0f) {
+            return;
+        }
+        if (projectMSnapshotStartSeconds_ < 0.0) {
+            if (projectMDisplayPresetGeneration_ < projectMSnapshotPresetGeneration_ &&
+                nowSeconds - projectMSnapshotRequestSeconds_ < kSnapshotFirstFrameTimeoutSeconds) {
+                projectMSnapshotFade_ = 0.0f;
+                return;
+            }
+            projectMSnapshotStartSeconds_ = nowSeconds;
+        }
+        const float t = static_cast<float>(
+            std::clamp((nowSeconds - projectMSnapshotStartSeconds_) / kPresetBlendSeconds, 0.0, 1.0));
+        projectMSnapshotFade_ = t * t * (3.0f - 2.0f * t);
+        if (t >= 1.0f) {
+            projectMSnapshotFade_ = 1.0f;
+        }
+    }
+
+    void DestroyProjectMSnapshot() {
+        if (projectMSnapshotFramebuffer_ != 0) {
+            glDeleteFramebuffers(1, &projectMSnapshotFramebuffer_);
+            projectMSnapshotFramebuffer_ = 0;
+        }
+        if (projectMSnapshotTexture_ != 0) {
+            glDeleteTextures(1, &projectMSnapshotTexture_);
+            projectMSnapshotTexture_ = 0;
+        }
+        projectMSnapshotFade_ = 1.0f;
+    }
+
+    // Repeated deadline overruns reported by the render thread cut straight to the built-in preset, without the
+    // grace period and hold the smoothed-FPS auto-skip needs, and quarantine the offender for the session (it is
+    // also marked slow, so later launches skip it too). The next library preset loads after a short pause.
+    bool UpdateProjectMWatchdog(double nowSeconds) {
+        if (watchdogResumeSeconds_ >= 0.0 && nowSeconds >= watchdogResumeSeconds_) {
+            watchdogResumeSeconds_ = -1.0;
+            if (usingFallbackPreset_ && currentPresetIndex_ < presetFiles_.size()) {
+                RequestPerformanceBoost(kPerfBoostAfterPresetSwitchSeconds);
+                presetBlendSeconds_ = BeginPresetTransition(presetFiles_[currentPresetIndex_], true);
+                LoadProjectMPresetFile(presetFiles_[currentPresetIndex_], presetBlendSeconds_);
+                ApplyPresetCadenceLevel();
+                usingFallbackPreset_ = false;
+                lastPresetSwitchSeconds_ = nowSeconds;
+                currentPresetLabel_ = BuildPresetDisplayLabel(presetFiles_[currentPresetIndex_]);
+                return true;
+            }
+        }
+        if (!perfWatchdogEnabled_ || usingFallbackPreset_ || projectM_ == nullptr ||
+            currentPresetIndex_ >= presetFiles_.size()) {
+            return false;
+        }
+        const int streak = projectMWatchdogStreak_.load();
+        if (streak < perfWatchdogOverruns_) {
+            return false;
+        }
+
+        const std::string offenderPath = presetFiles_[currentPresetIndex_];
+        const std::string offenderLabel = currentPresetLabel_;
+        quarantinedPresets_.push_back(PresetHistoryKey(offenderPath));
+        InvalidateSelectablePresetCountCache();
+        MarkCurrentPresetSlow(nowSeconds, "watchdog");
+
+        PostProjectMJob([this]() {
+            projectm_load_preset_data(projectM_, kFallbackPreset, false);
+            ResetProjectMPassSamples();
+            ResetProjectMWatchdog();
+        });
+        projectMWatchdogStreak_.store(0);
+        usingFallbackPreset_ = true;
+        currentPresetLabel_ = "FALLBACK";
+        lastPresetSwitchSeconds_ = nowSeconds;
+        lastAutoSkipSeconds_ = nowSeconds;
+        lowFpsSinceSeconds_ = -1.0;
+
+        size_t nextIndex = currentPresetIndex_;
+        const bool favoritesOnly = favoritesOnlyMode_ && HasAnyFavoritedPresetsInLibrary();
+        if (FindPresetIndexRelative(+1, skipMarkedPresets_, favoritesOnly, nextIndex) ||
+            FindPresetIndexRelative(+1, false, favoritesOnly, nextIndex)) {
+            currentPresetIndex_ = nextIndex;
+            watchdogResumeSeconds_ = nowSeconds + kWatchdogFallbackSeconds;
+        }
+
+        SetHudInputFeedback(nowSeconds, "WATCHDOG: PRESET QUARANTINED");
+        ExtendHudVisibility(nowSeconds, kHudVisibleAfterInteractionSeconds);
+        LOGW("projectM watchdog: %d consecutive frames over %.0fms, quarantined %s (%s), %llu overruns this session",
+             streak,
+             static_cast<double>(projectMWatchdogDeadlineMs_.load()),
+             offenderLabel.c_str(),
+             offenderPath.c_str(),
+             static_cast<unsigned long long>(projectMWatchdogOverruns_.load()));
+        return true;
     }
 
     std::string BuildPresetDisplayLabel(const std::string& presetPath) const {
@@ -3278,60 +6624,72 @@ private:
         }
     }
 
-    void DrawHudTextCentered(float minU,
-                             float maxU,
-                             float minV,
-                             float maxV,
-                             const std::string& text,
-                             int scale,
-                             uint8_t alpha = 255) {
-        if (text.empty()) {
-            return;
-        }
-
-        const int rectMinX = static_cast<int>(minU * static_cast<float>(kHudTextTextureWidth));
-        const int rectMaxX = static_cast<int>(maxU * static_cast<float>(kHudTextTextureWidth));
-        const int rectTop = static_cast<int>((1.0f - maxV) * static_cast<float>(kHudTextTextureHeight));
-        const int rectBottom = static_cast<int>((1.0f - minV) * static_cast<float>(kHudTextTextureHeight));
-
-        const int rectWidth = std::max(0, rectMaxX - rectMinX);
-        const int horizontalPadding = std::max(2, scale);
-        const int usableWidth = std::max(0, rectWidth - horizontalPadding * 2);
-        const std::string fittedText = FitHudTextToWidth(text, scale, usableWidth);
-        if (fittedText.empty()) {
-            return;
-        }
-
-        const int textWidth = MeasureHudTextWidth(fittedText, scale);
-        const int textHeight = kHudGlyphHeight * scale;
-
-        const int x = rectMinX + horizontalPadding + std::max(0, (usableWidth - textWidth) / 2);
-        const int y = rectTop + std::max(0, (rectBottom - rectTop - textHeight) / 2);
-        DrawHudText(hudTextPixels_, x, y, scale, fittedText, alpha);
-    }
-
     std::string BuildRenderStatsHudLabel() const {
         const double smoothedFps = 1.0 / std::max(smoothedFrameSeconds_, 1e-4);
         char text[176] = {};
         if (projectMUseUpscaler_) {
             std::snprintf(text,
                           sizeof(text),
-                          "SGSR ON  %dx%d -> %ux%u  SCALE %.2f  FPS %.0f",
+                          "SGSR %dx%d>%ux%u S%.2f",
                           projectMRenderWidth_,
                           projectMRenderHeight_,
                           static_cast<unsigned>(projectMOutputWidth_),
                           static_cast<unsigned>(projectMOutputHeight_),
-                          EffectiveProjectMRenderScale(),
-                          std::round(smoothedFps));
+                          EffectiveProjectMRenderScale());
         } else {
             std::snprintf(text,
                           sizeof(text),
-                          "SGSR OFF  NATIVE %ux%u  FPS %.0f",
+                          "NATIVE %ux%u",
                           static_cast<unsigned>(projectMOutputWidth_),
-                          static_cast<unsigned>(projectMOutputHeight_),
-                          std::round(smoothedFps));
-        }
-        return SanitizeHudText(text, 72);
+                          static_cast<unsigned>(projectMOutputHeight_));
+        }
+        size_t used = std::strlen(text);
+        if (!swapchains_.empty()) {
+            const XrExtent2Di eyeExtent = EyeBufferRectExtent(swapchains_.front());
+            std::snprintf(text + used, sizeof(text) - used, "  EYE %dx%d", eyeExtent.width, eyeExtent.height);
+            used = std::strlen(text);
+        }
+        if (foveationReady_) {
+            std::snprintf(text + used,
+                          sizeof(text) - used,
+                          "  FFR %s%s",
+                          FoveationLevelLabel(appliedFoveationLevel_),
+                          appliedFoveationDynamic_ ? "+D" : "");
+            used = std::strlen(text);
+        }
+        if (projectMCadenceLevel_ > 0) {
+            std::snprintf(text + used,
+                          sizeof(text) - used,
+                          "  PM %s",
+                          kProjectMCadenceLabels[static_cast<size_t>(projectMCadenceLevel_)]);
+            used = std::strlen(text);
+        }
+        if (spaceWarpSubmitting_) {
+            std::snprintf(text + used, sizeof(text) - used, "  ASW");
+            used = std::strlen(text);
+        }
+        if (QualityGovernorActive()) {
+            std::snprintf(text + used, sizeof(text) - used, "  Q%zu/%zu", qualityRung_ + 1, qualityLadder_.size());
+            used = std::strlen(text);
+        }
+        std::snprintf(text + used,
+                      sizeof(text) - used,
+                      "  FPS %.0f/%.0f",
+                      std::round(smoothedFps),
+                      std::round(static_cast<double>(activeDisplayRefreshRate_)));
+        used = std::strlen(text);
+        const std::array<GpuPassStats, kGpuPassCount> gpuStats = SnapshotGpuPassStats();
+        const GpuPassStats& projectMGpu = gpuStats[static_cast<size_t>(GpuPass::ProjectM)];
+        const GpuPassStats& eyeGpu = gpuStats[static_cast<size_t>(GpuPass::Eye)];
+        if (projectMGpu.samples > 0 || eyeGpu.samples > 0) {
+            // p95 is what decides whether a frame misses; the full table is in the log and stats dump.
+            std::snprintf(text + used,
+                          sizeof(text) - used,
+                          "  GPU95 PM %.1f EYE %.1f",
+                          static_cast<double>(projectMGpu.p95Ms),
+                          static_cast<double>(eyeGpu.p95Ms));
+        }
+        return SanitizeHudText(text, 96);
     }
 
     std::string BuildPresetHudLineLabel(const std::string& presetLabel, double nowSeconds) const {
@@ -3365,103 +6723,630 @@ private:
             return FitHudTextToWidth(prefix, scale, usableWidth);
         }
 
-        return prefix + BuildHudMarqueeText(presetLabel,
-                                            visibleChars,
-                                            nowSeconds,
-                                            presetMarqueeStartSeconds_);
+        return prefix + BuildHudMarqueeText(presetLabel,
+                                            visibleChars,
+                                            nowSeconds,
+                                            presetMarqueeStartSeconds_);
+    }
+
+    // Main-thread half of the HUD text path: builds the label strings (they read app state), hands them to
+    // the HUD text thread when any changed, and kicks the upload of whatever that thread last finished.
+    void UpdateHudText(double nowSeconds) {
+        if (hudTextTexture_ == 0 || !hudTextThread_.joinable()) {
+            return;
+        }
+        if (!hudEnabled_ || nowSeconds > hudVisibleUntilSeconds_) {
+            return;
+        }
+
+        const std::string audioLabel = SanitizeHudText(AudioModeLabel(), 18);
+        const std::string projectionLabel =
+            projectionMode_ == ProjectionMode::FrontDome ? "DOME" : "SPHERE";
+        const std::string playbackLabel = currentMediaPlaying_ ? "PLAYING" : "PAUSED";
+        const std::string presetLabel = SanitizeHudText(currentPresetLabel_, kMaxPresetHudLabelChars);
+        if (presetLabel != hudPresetSourceLabel_) {
+            hudPresetSourceLabel_ = presetLabel;
+            presetMarqueeStartSeconds_ = nowSeconds;
+        }
+        const std::string presetLineLabel = BuildPresetHudLineLabel(hudPresetSourceLabel_, nowSeconds);
+        const std::string trackLabel = BuildTrackDisplayLabel(currentMediaLabel_);
+        const std::string favoriteLabel = IsCurrentPresetFavorited() ? "STAR PRESET ON" : "STAR PRESET OFF";
+        const std::string presetLockLabel = lockCurrentPreset_ ? "LOCK PRESET ON" : "LOCK PRESET OFF";
+        const std::string bottomLeftLabel = hudUtilityPanelOpen_ ? "PACK" : "UTILS";
+        const std::string bottomCenterLabel = hudUtilityPanelOpen_
+            ? (favoritesOnlyMode_ ? "SHOW FAVS ON" : "SHOW FAVS OFF")
+            : "AUDIO MODE";
+        const std::string bottomRightLabel = hudUtilityPanelOpen_ ? "BACK" : "PROJECTION";
+        const std::string infoLabel = nowSeconds <= hudInputFeedbackUntilSeconds_
+            ? SanitizeHudText(hudInputFeedbackLabel_, 56)
+            : ("TRACK: " + trackLabel);
+        const std::string renderStatsLabel = BuildRenderStatsHudLabel();
+
+        std::array<std::string, kHudTextLabelCount> labels;
+        labels[static_cast<size_t>(HudTextLabel::Audio)] = "AUD " + audioLabel;
+        labels[static_cast<size_t>(HudTextLabel::Projection)] = "PROJ " + projectionLabel;
+        labels[static_cast<size_t>(HudTextLabel::Playback)] = "PLAY " + playbackLabel;
+        labels[static_cast<size_t>(HudTextLabel::Preset)] = presetLineLabel;
+        labels[static_cast<size_t>(HudTextLabel::RenderStats)] = renderStatsLabel;
+        labels[static_cast<size_t>(HudTextLabel::PrevPreset)] = "PREV PRESET";
+        labels[static_cast<size_t>(HudTextLabel::NextPreset)] = "NEXT PRESET";
+        labels[static_cast<size_t>(HudTextLabel::TogglePlay)] = "PLAY PAUSE";
+        labels[static_cast<size_t>(HudTextLabel::NextTrack)] = "NEXT TRACK";
+        labels[static_cast<size_t>(HudTextLabel::Favorite)] = favoriteLabel;
+        labels[static_cast<size_t>(HudTextLabel::PresetLock)] = presetLockLabel;
+        labels[static_cast<size_t>(HudTextLabel::InputFeedback)] = infoLabel;
+        labels[static_cast<size_t>(HudTextLabel::BottomLeft)] = bottomLeftLabel;
+        labels[static_cast<size_t>(HudTextLabel::BottomCenter)] = bottomCenterLabel;
+        labels[static_cast<size_t>(HudTextLabel::BottomRight)] = bottomRightLabel;
+
+        if (!hudTextLabelsSubmitted_ || labels != hudTextSubmittedLabels_) {
+            {
+                std::lock_guard<std::mutex> lock(hudTextMutex_);
+                hudTextJobLabels_ = labels;
+                hudTextJobPending_ = true;
+            }
+            hudTextCondition_.notify_one();
+            hudTextSubmittedLabels_ = std::move(labels);
+            hudTextLabelsSubmitted_ = true;
+        }
+
+        UploadHudTextIfReady();
+    }
+
+    void StartHudTextThread() {
+        hudTextThreadStop_ = false;
+        hudTextJobPending_ = false;
+        hudTextLabelsSubmitted_ = false;
+        hudTextThread_ = std::thread([this]() { HudTextThreadMain(); });
+    }
+
+    void StopHudTextThread() {
+        if (!hudTextThread_.joinable()) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(hudTextMutex_);
+            hudTextThreadStop_ = true;
+        }
+        hudTextCondition_.notify_all();
+        hudTextThread_.join();
+    }
+
+    // Owns hudTextLabels_, hudTextPixels_ and hudTextWorkerUpload_ while running. Only the newest label set
+    // is rasterized; packed passes accumulate until the render thread maps a buffer, then the thread copies
+    // them straight into it so the render thread never touches the pixels.
+    void HudTextThreadMain() {
+        std::array<std::string, kHudTextLabelCount> labels;
+        for (;;) {
+            bool rasterize = false;
+            {
+                std::unique_lock<std::mutex> lock(hudTextMutex_);
+                hudTextCondition_.wait(lock, [this]() {
+                    return hudTextThreadStop_ || hudTextJobPending_ ||
+                           (!hudTextWorkerUpload_.rects.empty() && FindMappedHudTextPboLocked() != nullptr);
+                });
+                if (hudTextThreadStop_) {
+                    return;
+                }
+                if (hudTextJobPending_) {
+                    labels = hudTextJobLabels_;
+                    hudTextJobPending_ = false;
+                    rasterize = true;
+                }
+            }
+
+            if (rasterize) {
+                const auto rasterStart = std::chrono::steady_clock::now();
+                if (RasterizeHudTextLabels(labels)) {
+                    PackHudTextDirtyRects(hudTextWorkerUpload_);
+                    if (hudTextWorkerUpload_.pixels.size() > kHudTextPboBytes) {
+                        // Passes piled up while no buffer was mapped; one full-texture rect supersedes them.
+                        hudTextWorkerUpload_.rects.clear();
+                        hudTextWorkerUpload_.pixels.clear();
+                        hudTextDirtyRects_.assign(1, HudPixelRect{0, 0, kHudTextTextureWidth, kHudTextTextureHeight});
+                        PackHudTextDirtyRects(hudTextWorkerUpload_);
+                    }
+                    const double rasterMicros =
+                        std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - rasterStart)
+                            .count();
+                    std::lock_guard<std::mutex> lock(hudTextMutex_);
+                    ++hudTextUpdatesSinceLog_;
+                    hudTextRasterMaxMicros_ = std::max(hudTextRasterMaxMicros_, rasterMicros);
+                }
+            }
+            if (hudTextWorkerUpload_.rects.empty()) {
+                continue;
+            }
+
+            HudTextPbo* target = nullptr;
+            {
+                std::lock_guard<std::mutex> lock(hudTextMutex_);
+                target = FindMappedHudTextPboLocked();
+            }
+            if (target == nullptr) {
+                continue;
+            }
+            // The render thread leaves a Mapped buffer alone until it is marked Filled, so the copy needs no lock.
+            std::memcpy(target->mapped, hudTextWorkerUpload_.pixels.data(), hudTextWorkerUpload_.pixels.size());
+            std::lock_guard<std::mutex> lock(hudTextMutex_);
+            target->rects.swap(hudTextWorkerUpload_.rects);
+            target->state = HudTextPboState::Filled;
+            hudTextWorkerUpload_.rects.clear();
+            hudTextWorkerUpload_.pixels.clear();
+        }
+    }
+
+    HudTextPbo* FindMappedHudTextPboLocked() {
+        for (HudTextPbo& pbo : hudTextPbos_) {
+            if (pbo.state == HudTextPboState::Mapped) {
+                return &pbo;
+            }
+        }
+        return nullptr;
+    }
+
+    // Updates hudTextPixels_ for the labels that changed and records the touched rectangles in
+    // hudTextDirtyRects_. Returns false when nothing changed.
+    bool RasterizeHudTextLabels(const std::array<std::string, kHudTextLabelCount>& labels) {
+        std::array<bool, kHudTextLabelCount> changed{};
+        bool anyChanged = false;
+        for (size_t i = 0; i < kHudTextLabelCount; ++i) {
+            changed[i] = !hudTextLabels_[i].drawn || hudTextLabels_[i].source != labels[i];
+            anyChanged = anyChanged || changed[i];
+        }
+        if (!anyChanged) {
+            return false;
+        }
+
+        hudTextDirtyRects_.clear();
+
+        // Clear every changed label's old pixels first, so a redraw below can never be erased by a later clear.
+        std::array<bool, kHudTextLabelCount> redraw = changed;
+        for (size_t i = 0; i < kHudTextLabelCount; ++i) {
+            if (!changed[i] || hudTextLabels_[i].bounds.width <= 0) {
+                continue;
+            }
+            const HudPixelRect& cleared = hudTextLabels_[i].bounds;
+            ClearHudPixelRect(hudTextPixels_, cleared);
+            hudTextDirtyRects_.push_back(cleared);
+            for (size_t j = 0; j < kHudTextLabelCount; ++j) {
+                if (!changed[j] && HudPixelRectsIntersect(cleared, hudTextLabels_[j].bounds)) {
+                    redraw[j] = true;
+                }
+            }
+        }
+
+        for (size_t i = 0; i < kHudTextLabelCount; ++i) {
+            if (!redraw[i]) {
+                continue;
+            }
+            HudTextLabelState& state = hudTextLabels_[i];
+            const HudTextLabelLayout& layout = kHudTextLabelLayouts[i];
+            if (changed[i]) {
+                HudTextPlacement placement = PlaceHudTextCentered(layout, labels[i]);
+                state.source = labels[i];
+                state.text = std::move(placement.text);
+                state.bounds = placement.bounds;
+                state.drawn = true;
+            }
+            DrawHudText(hudTextPixels_, state.bounds.x, state.bounds.y, layout.scale, state.text, layout.alpha);
+            if (state.bounds.width > 0) {
+                hudTextDirtyRects_.push_back(state.bounds);
+            }
+        }
+        return true;
+    }
+
+    // Copies each dirty rectangle out of hudTextPixels_ as tightly packed bottom-up rows, the layout
+    // glTexSubImage2D reads from the unpack buffer.
+    void PackHudTextDirtyRects(HudTextUpload& upload) const {
+        for (const HudPixelRect& rect : hudTextDirtyRects_) {
+            const HudPixelRect clipped = ClipHudPixelRect(rect);
+            if (clipped.width <= 0 || clipped.height <= 0) {
+                continue;
+            }
+            const int textureY = kHudTextTextureHeight - (clipped.y + clipped.height);
+            upload.rects.push_back(clipped);
+            for (int row = 0; row < clipped.height; ++row) {
+                const uint8_t* src =
+                    hudTextPixels_.data() + static_cast<size_t>((textureY + row) * kHudTextTextureWidth + clipped.x);
+                upload.pixels.insert(upload.pixels.end(), src, src + clipped.width);
+            }
+        }
+    }
+
+    // Render-thread side: recycle buffers whose upload has retired, unmap the ones the HUD text thread filled
+    // and source glTexSubImage2D from them, then map a free buffer for the next pass. The unsynchronized map
+    // is safe because a buffer only returns to Free once its upload fence has signaled.
+    void UploadHudTextIfReady() {
+        const auto uploadStart = std::chrono::steady_clock::now();
+        size_t uploadedBytes = 0;
+        for (HudTextPbo& pbo : hudTextPbos_) {
+            HudTextPboState state = HudTextPboState::Free;
+            {
+                std::lock_guard<std::mutex> lock(hudTextMutex_);
+                state = pbo.state;
+            }
+            if (state == HudTextPboState::Uploading) {
+                if (glClientWaitSync(pbo.fence, 0, 0) == GL_TIMEOUT_EXPIRED) {
+                    continue;
+                }
+                glDeleteSync(pbo.fence);
+                pbo.fence = nullptr;
+                std::lock_guard<std::mutex> lock(hudTextMutex_);
+                pbo.state = HudTextPboState::Free;
+            } else if (state == HudTextPboState::Filled) {
+                uploadedBytes += UploadHudTextPbo(pbo);
+            }
+        }
+
+        HudTextPbo* freePbo = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(hudTextMutex_);
+            if (FindMappedHudTextPboLocked() == nullptr) {
+                for (HudTextPbo& pbo : hudTextPbos_) {
+                    if (pbo.state == HudTextPboState::Free) {
+                        freePbo = &pbo;
+                        break;
+                    }
+                }
+            }
+        }
+        if (freePbo != nullptr) {
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, freePbo->buffer);
+            void* mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER,
+                                            0,
+                                            static_cast<GLsizeiptr>(kHudTextPboBytes),
+                                            GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT |
+                                                GL_MAP_UNSYNCHRONIZED_BIT);
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            if (mapped != nullptr) {
+                {
+                    std::lock_guard<std::mutex> lock(hudTextMutex_);
+                    freePbo->mapped = static_cast<uint8_t*>(mapped);
+                    freePbo->state = HudTextPboState::Mapped;
+                }
+                hudTextCondition_.notify_one();
+            }
+        }
+
+        if (uploadedBytes == 0) {
+            return;
+        }
+        const double uploadMicros =
+            std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - uploadStart).count();
+        hudTextUploadBytesSinceLog_ += uploadedBytes;
+        hudTextUploadMaxMicros_ = std::max(hudTextUploadMaxMicros_, uploadMicros);
+    }
+
+    // Unmaps a Filled buffer and issues its texture updates; the fence retires it once the GPU has read it.
+    size_t UploadHudTextPbo(HudTextPbo& pbo) {
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo.buffer);
+        const bool intact = glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER) == GL_TRUE;
+        pbo.mapped = nullptr;
+        size_t offset = 0;
+        if (intact) {
+            glBindTexture(GL_TEXTURE_2D, hudTextTexture_);
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+            for (const HudPixelRect& rect : pbo.rects) {
+                glTexSubImage2D(GL_TEXTURE_2D,
+                                0,
+                                rect.x,
+                                kHudTextTextureHeight - (rect.y + rect.height),
+                                rect.width,
+                                rect.height,
+                                GL_RED,
+                                GL_UNSIGNED_BYTE,
+                                reinterpret_cast<const void*>(offset));
+                offset += static_cast<size_t>(rect.width * rect.height);
+            }
+            glBindTexture(GL_TEXTURE_2D, 0);
+        } else {
+            LOGW("HUD text unpack buffer contents lost; dropping %zu rect(s)", pbo.rects.size());
+        }
+        // Leaving the unpack buffer bound would redirect every later texture upload on this context.
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        pbo.rects.clear();
+        pbo.fence = intact ? glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0) : nullptr;
+        std::lock_guard<std::mutex> lock(hudTextMutex_);
+        pbo.state = pbo.fence != nullptr ? HudTextPboState::Uploading : HudTextPboState::Free;
+        return offset;
+    }
+
+    // Starts or stops capturing. Files from one capture run share a timestamp prefix so runs never overwrite
+    // each other.
+    void SetCaptureMode(double nowSeconds, CaptureMode mode) {
+        if (mode != CaptureMode::Off) {
+            const char* basePath = app_->activity->externalDataPath != nullptr ? app_->activity->externalDataPath
+                                                                               : app_->activity->internalDataPath;
+            captureDirectory_ = basePath != nullptr ? std::string(basePath) + "/captures" : std::string();
+            if (captureDirectory_.empty() || !EnsureDirectory(captureDirectory_)) {
+                LOGW("Frame capture unavailable: cannot create %s", captureDirectory_.c_str());
+                captureMode_ = mode;
+                captureDirectory_.clear();
+                return;
+            }
+            char prefix[40] = {};
+            const std::time_t wallClock = std::time(nullptr);
+            std::tm localTime{};
+            localtime_r(&wallClock, &localTime);
+            std::strftime(prefix, sizeof(prefix), "capture_%Y%m%d_%H%M%S", &localTime);
+            captureSessionPrefix_ = prefix;
+            captureSequence_ = 0;
+            nextCaptureSeconds_ = nowSeconds;
+            if (!captureThread_.joinable()) {
+                StartCaptureThread();
+            }
+        }
+        captureMode_ = mode;
+        const char* modeLabel = mode == CaptureMode::ProjectM ? "projectM"
+                                : mode == CaptureMode::Eye   ? "eye"
+                                : mode == CaptureMode::Both  ? "projectM+eye"
+                                                             : "off";
+        LOGI("Frame capture: %s every %.2fs (max %d) to %s",
+             modeLabel,
+             captureIntervalSeconds_,
+             captureMaxFrames_,
+             captureDirectory_.c_str());
+        SetHudInputFeedback(nowSeconds, mode == CaptureMode::Off ? "CAPTURE OFF" : "CAPTURE ON");
+    }
+
+    bool CaptureIncludes(CaptureMode source) const {
+        return captureMode_ == source || captureMode_ == CaptureMode::Both;
+    }
+
+    // Called once per displayed frame after the projectM frame is consumed. Unmaps what the capture thread
+    // finished, hands completed readbacks to it, and issues the projectM readback when a capture is due; the eye
+    // readback is issued from the eye loop. Nothing here waits on the GPU.
+    void UpdateFrameCapture(double nowSeconds) {
+        ++captureFrameIndex_;
+        bool slotsBusy = false;
+        for (const CaptureSlot& slot : captureSlots_) {
+            slotsBusy = slotsBusy || slot.state != CaptureSlotState::Free;
+        }
+        if (captureFrameActive_) {
+            captureCostMicrosTotal_ += captureFrameMicros_;
+            captureCostMaxMicros_ = std::max(captureCostMaxMicros_, captureFrameMicros_);
+            ++captureCostFrames_;
+        }
+        captureFrameMicros_ = 0.0;
+        captureFrameDue_ = false;
+        captureFrameActive_ = (captureMode_ != CaptureMode::Off && !captureDirectory_.empty()) || slotsBusy;
+        if (!captureFrameActive_) {
+            return;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        ReleaseWrittenCaptureSlots();
+        MapCompletedCaptureSlots();
+        if (captureMode_ != CaptureMode::Off && !captureDirectory_.empty() && nowSeconds >= nextCaptureSeconds_ &&
+            captureSequence_ < static_cast<uint32_t>(captureMaxFrames_)) {
+            captureFrameDue_ = true;
+            ++captureSequence_;
+            nextCaptureSeconds_ = nowSeconds + captureIntervalSeconds_;
+            if (captureSequence_ == static_cast<uint32_t>(captureMaxFrames_)) {
+                LOGI("Frame capture reached max_frames (%d); set debug.projectm.quest.capture off to restart.",
+                     captureMaxFrames_);
+            }
+            if (CaptureIncludes(CaptureMode::ProjectM) && projectMTexture_ != 0) {
+                // Float targets would need a float readback; only the normalized formats are captured.
+                if (projectMOutputFormat_ == RenderTargetFormat::R11G11B10F) {
+                    ++captureSkippedSinceLog_;
+                } else {
+                    if (captureFramebuffer_ == 0) {
+                        glGenFramebuffers(1, &captureFramebuffer_);
+                    }
+                    glBindFramebuffer(GL_READ_FRAMEBUFFER, captureFramebuffer_);
+                    glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, projectMTexture_, 0);
+                    IssueCaptureReadback(0,
+                                         0,
+                                         static_cast<int>(projectMOutputWidth_),
+                                         static_cast<int>(projectMOutputHeight_),
+                                         "projectm");
+                    glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+                }
+            }
+        }
+        captureFrameMicros_ +=
+            std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Called with the first eye's framebuffer bound, after everything is drawn into it.
+    void CaptureEyeBufferIfDue(const XrRect2Di& rect) {
+        if (!captureFrameDue_ || !CaptureIncludes(CaptureMode::Eye)) {
+            return;
+        }
+        const auto start = std::chrono::steady_clock::now();
+        IssueCaptureReadback(rect.offset.x, rect.offset.y, rect.extent.width, rect.extent.height, "eye");
+        captureFrameMicros_ +=
+            std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Queues an asynchronous copy of the bound read framebuffer into a free PBO of the ring. A full ring skips
+    // the capture rather than waiting.
+    void IssueCaptureReadback(int x, int y, int width, int height, const char* sourceLabel) {
+        CaptureSlot* slot = nullptr;
+        for (CaptureSlot& candidate : captureSlots_) {
+            if (candidate.state == CaptureSlotState::Free) {
+                slot = &candidate;
+                break;
+            }
+        }
+        if (slot == nullptr || width <= 0 || height <= 0) {
+            ++captureSkippedSinceLog_;
+            return;
+        }
+        if (slot->pbo == 0) {
+            glGenBuffers(1, &slot->pbo);
+        }
+        const size_t size = static_cast<size_t>(width) * static_cast<size_t>(height) * 4;
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, slot->pbo);
+        if (slot->capacity < size) {
+            glBufferData(GL_PIXEL_PACK_BUFFER, static_cast<GLsizeiptr>(size), nullptr, GL_STREAM_READ);
+            slot->capacity = size;
+        }
+        glReadPixels(x, y, width, height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        // Leaving the pack buffer bound would redirect every later glReadPixels on this context.
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        slot->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        slot->state = CaptureSlotState::Issued;
+        slot->width = width;
+        slot->height = height;
+        slot->issuedFrame = captureFrameIndex_;
+        char name[96] = {};
+        std::snprintf(name, sizeof(name), "/%s_%05u_%s.ppm", captureSessionPrefix_.c_str(), captureSequence_, sourceLabel);
+        slot->path = captureDirectory_ + name;
+        ++captureReadbacksSinceLog_;
+    }
+
+    void MapCompletedCaptureSlots() {
+        bool bound = false;
+        for (size_t i = 0; i < captureSlots_.size(); ++i) {
+            CaptureSlot& slot = captureSlots_[i];
+            if (slot.state != CaptureSlotState::Issued ||
+                captureFrameIndex_ - slot.issuedFrame < kCaptureReadbackDelayFrames ||
+                glClientWaitSync(slot.fence, 0, 0) == GL_TIMEOUT_EXPIRED) {
+                continue;
+            }
+            glDeleteSync(slot.fence);
+            slot.fence = nullptr;
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo);
+            bound = true;
+            const size_t size = static_cast<size_t>(slot.width) * static_cast<size_t>(slot.height) * 4;
+            void* mapped = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, static_cast<GLsizeiptr>(size), GL_MAP_READ_BIT);
+            if (mapped == nullptr) {
+                LOGW("Could not map capture readback: %s", slot.path.c_str());
+                slot.state = CaptureSlotState::Free;
+                continue;
+            }
+            // The capture thread reads the mapping directly, so this thread never copies the pixels.
+            slot.state = CaptureSlotState::Mapped;
+            CaptureJob job;
+            job.slot = i;
+            job.pixels = static_cast<const uint8_t*>(mapped);
+            job.width = slot.width;
+            job.height = slot.height;
+            job.path = slot.path;
+            {
+                std::lock_guard<std::mutex> lock(captureMutex_);
+                captureJobs_.push_back(std::move(job));
+            }
+            captureCondition_.notify_one();
+        }
+        if (bound) {
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        }
+    }
+
+    void ReleaseWrittenCaptureSlots() {
+        std::vector<size_t> written;
+        {
+            std::lock_guard<std::mutex> lock(captureMutex_);
+            written.swap(captureWrittenSlots_);
+        }
+        for (const size_t index : written) {
+            CaptureSlot& slot = captureSlots_[index];
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo);
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+            slot.state = CaptureSlotState::Free;
+        }
+        if (!written.empty()) {
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        }
+    }
+
+    void StartCaptureThread() {
+        captureThreadStop_ = false;
+        captureThread_ = std::thread([this]() { CaptureThreadMain(); });
     }
 
-    void RefreshHudTextTextureIfNeeded(double nowSeconds) {
-        if (hudTextTexture_ == 0) {
+    void StopCaptureThread() {
+        if (!captureThread_.joinable()) {
             return;
         }
-
-        const std::string audioLabel = SanitizeHudText(AudioModeLabel(), 18);
-        const std::string projectionLabel =
-            projectionMode_ == ProjectionMode::FrontDome ? "DOME" : "SPHERE";
-        const std::string playbackLabel = currentMediaPlaying_ ? "PLAYING" : "PAUSED";
-        const std::string presetLabel = SanitizeHudText(currentPresetLabel_, kMaxPresetHudLabelChars);
-        if (presetLabel != hudPresetSourceLabel_) {
-            hudPresetSourceLabel_ = presetLabel;
-            presetMarqueeStartSeconds_ = nowSeconds;
+        {
+            std::lock_guard<std::mutex> lock(captureMutex_);
+            captureThreadStop_ = true;
         }
-        const std::string presetLineLabel = BuildPresetHudLineLabel(hudPresetSourceLabel_, nowSeconds);
-        const std::string trackLabel = BuildTrackDisplayLabel(currentMediaLabel_);
-        const std::string favoriteLabel = IsCurrentPresetFavorited() ? "STAR PRESET ON" : "STAR PRESET OFF";
-        const std::string presetLockLabel = lockCurrentPreset_ ? "LOCK PRESET ON" : "LOCK PRESET OFF";
-        const std::string bottomLeftLabel = hudUtilityPanelOpen_ ? "PACK" : "UTILS";
-        const std::string bottomCenterLabel = hudUtilityPanelOpen_
-            ? (favoritesOnlyMode_ ? "SHOW FAVS ON" : "SHOW FAVS OFF")
-            : "AUDIO MODE";
-        const std::string bottomRightLabel = hudUtilityPanelOpen_ ? "BACK" : "PROJECTION";
-        const std::string infoLabel = nowSeconds <= hudInputFeedbackUntilSeconds_
-            ? SanitizeHudText(hudInputFeedbackLabel_, 56)
-            : ("TRACK: " + trackLabel);
-        const std::string renderStatsLabel = BuildRenderStatsHudLabel();
+        captureCondition_.notify_all();
+        captureThread_.join();
+    }
 
-        const bool changed =
-            hudTextDirty_ ||
-            hudRenderedAudioLabel_ != audioLabel ||
-            hudRenderedProjectionLabel_ != projectionLabel ||
-            hudRenderedPlaybackLabel_ != playbackLabel ||
-            hudRenderedPresetLabel_ != presetLineLabel ||
-            hudRenderedFavoriteLabel_ != favoriteLabel ||
-            hudRenderedPresetLockLabel_ != presetLockLabel ||
-            hudRenderedBottomLeftLabel_ != bottomLeftLabel ||
-            hudRenderedBottomCenterLabel_ != bottomCenterLabel ||
-            hudRenderedBottomRightLabel_ != bottomRightLabel ||
-            hudRenderedRenderStatsLabel_ != renderStatsLabel ||
-            hudRenderedTrackLabel_ != trackLabel ||
-            hudRenderedInputFeedbackLabel_ != infoLabel;
-
-        if (!changed) {
-            return;
+    // Writes each readback straight from its mapped buffer and reports the slot back for unmapping. The queue is
+    // drained before the thread exits, so captures in flight at shutdown are still saved.
+    void CaptureThreadMain() {
+        for (;;) {
+            CaptureJob job;
+            {
+                std::unique_lock<std::mutex> lock(captureMutex_);
+                captureCondition_.wait(lock, [this]() { return captureThreadStop_ || !captureJobs_.empty(); });
+                if (captureJobs_.empty()) {
+                    return;
+                }
+                job = std::move(captureJobs_.front());
+                captureJobs_.pop_front();
+            }
+
+            const auto writeStart = std::chrono::steady_clock::now();
+            const bool written = WriteCapturePpm(job);
+            const double writeMillis =
+                std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - writeStart).count();
+            if (!written) {
+                LOGW("Could not write capture: %s", job.path.c_str());
+            }
+
+            std::lock_guard<std::mutex> lock(captureMutex_);
+            captureWrittenSlots_.push_back(job.slot);
+            if (written) {
+                ++captureFilesWrittenSinceLog_;
+            }
+            captureWriteMaxMillis_ = std::max(captureWriteMaxMillis_, writeMillis);
         }
+    }
 
-        hudRenderedAudioLabel_ = audioLabel;
-        hudRenderedProjectionLabel_ = projectionLabel;
-        hudRenderedPlaybackLabel_ = playbackLabel;
-        hudRenderedPresetLabel_ = presetLineLabel;
-        hudRenderedFavoriteLabel_ = favoriteLabel;
-        hudRenderedPresetLockLabel_ = presetLockLabel;
-        hudRenderedBottomLeftLabel_ = bottomLeftLabel;
-        hudRenderedBottomCenterLabel_ = bottomCenterLabel;
-        hudRenderedBottomRightLabel_ = bottomRightLabel;
-        hudRenderedRenderStatsLabel_ = renderStatsLabel;
-        hudRenderedTrackLabel_ = trackLabel;
-        hudRenderedInputFeedbackLabel_ = infoLabel;
-        hudTextDirty_ = false;
-
-        std::fill(hudTextPixels_.begin(), hudTextPixels_.end(), 0);
-        DrawHudTextCentered(0.05f, 0.34f, 0.885f, 0.93f, "AUD " + hudRenderedAudioLabel_, kHudStatusScale);
-        DrawHudTextCentered(0.36f, 0.64f, 0.885f, 0.93f, "PROJ " + hudRenderedProjectionLabel_, kHudStatusScale);
-        DrawHudTextCentered(0.66f, 0.95f, 0.885f, 0.93f, "PLAY " + hudRenderedPlaybackLabel_, kHudStatusScale);
-        DrawHudTextCentered(0.05f, 0.95f, 0.835f, 0.875f, hudRenderedPresetLabel_, kHudDetailScale);
-        DrawHudTextCentered(0.05f, 0.95f, 0.785f, 0.825f, hudRenderedRenderStatsLabel_, kHudDetailScale, 210);
-
-        DrawHudTextCentered(kHudRectPrevPreset.minU, kHudRectPrevPreset.maxU, kHudRectPrevPreset.minV, kHudRectPrevPreset.maxV, "PREV PRESET", kHudActionScale);
-        DrawHudTextCentered(kHudRectNextPreset.minU, kHudRectNextPreset.maxU, kHudRectNextPreset.minV, kHudRectNextPreset.maxV, "NEXT PRESET", kHudActionScale);
-        DrawHudTextCentered(kHudRectTogglePlay.minU, kHudRectTogglePlay.maxU, kHudRectTogglePlay.minV, kHudRectTogglePlay.maxV, "PLAY PAUSE", kHudActionScale);
-        DrawHudTextCentered(kHudRectNextTrack.minU, kHudRectNextTrack.maxU, kHudRectNextTrack.minV, kHudRectNextTrack.maxV, "NEXT TRACK", kHudActionScale);
-        DrawHudTextCentered(kHudRectFavorite.minU, kHudRectFavorite.maxU, kHudRectFavorite.minV, kHudRectFavorite.maxV, hudRenderedFavoriteLabel_, kHudInputScale, 170);
-        DrawHudTextCentered(kHudRectPresetLock.minU, kHudRectPresetLock.maxU, kHudRectPresetLock.minV, kHudRectPresetLock.maxV, hudRenderedPresetLockLabel_, kHudInputScale, 170);
-        DrawHudTextCentered(0.07f, 0.93f, 0.245f, 0.295f, hudRenderedInputFeedbackLabel_, kHudInputScale, 190);
-        DrawHudTextCentered(kHudRectPack.minU, kHudRectPack.maxU, kHudRectPack.minV, kHudRectPack.maxV, hudRenderedBottomLeftLabel_, kHudTriggerScale);
-        DrawHudTextCentered(kHudRectCenter.minU, kHudRectCenter.maxU, kHudRectCenter.minV, kHudRectCenter.maxV, hudRenderedBottomCenterLabel_, kHudTriggerScale);
-        DrawHudTextCentered(kHudRectProjection.minU, kHudRectProjection.maxU, kHudRectProjection.minV, kHudRectProjection.maxV, hudRenderedBottomRightLabel_, kHudTriggerScale);
+    void DestroyFrameCapture() {
+        StopCaptureThread();
+        ReleaseWrittenCaptureSlots();
+        for (CaptureSlot& slot : captureSlots_) {
+            if (slot.fence != nullptr) {
+                glDeleteSync(slot.fence);
+            }
+            if (slot.pbo != 0) {
+                glDeleteBuffers(1, &slot.pbo);
+            }
+            slot = CaptureSlot{};
+        }
+        if (captureFramebuffer_ != 0) {
+            glDeleteFramebuffers(1, &captureFramebuffer_);
+            captureFramebuffer_ = 0;
+        }
+    }
 
-        glBindTexture(GL_TEXTURE_2D, hudTextTexture_);
-        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-        glTexSubImage2D(GL_TEXTURE_2D,
-                        0,
-                        0,
-                        0,
-                        kHudTextTextureWidth,
-                        kHudTextTextureHeight,
-                        GL_RED,
-                        GL_UNSIGNED_BYTE,
-                        hudTextPixels_.data());
-        glBindTexture(GL_TEXTURE_2D, 0);
+    void LogCaptureStats() {
+        if (captureCostFrames_ == 0) {
+            return;
+        }
+        uint32_t filesWritten = 0;
+        double writeMaxMillis = 0.0;
+        {
+            std::lock_guard<std::mutex> lock(captureMutex_);
+            filesWritten = captureFilesWrittenSinceLog_;
+            writeMaxMillis = captureWriteMaxMillis_;
+            captureFilesWrittenSinceLog_ = 0;
+            captureWriteMaxMillis_ = 0.0;
+        }
+        LOGI("Capture stats: readbacks=%u written=%u skipped=%u frameCost avg=%.1fus max=%.1fus write max=%.1fms",
+             captureReadbacksSinceLog_,
+             filesWritten,
+             captureSkippedSinceLog_,
+             captureCostMicrosTotal_ / static_cast<double>(captureCostFrames_),
+             captureCostMaxMicros_,
+             writeMaxMillis);
+        captureReadbacksSinceLog_ = 0;
+        captureSkippedSinceLog_ = 0;
+        captureCostMicrosTotal_ = 0.0;
+        captureCostMaxMicros_ = 0.0;
+        captureCostFrames_ = 0;
     }
 
     bool GetActionPressed(XrAction action) const {
@@ -3861,7 +7746,6 @@ private:
                 CallJavaControlMethod("onNativeRequestOptionalCreamPack");
                 lastPresetScanSeconds_ = nowSeconds - kPresetScanIntervalSeconds;
                 hudUtilityPanelOpen_ = false;
-                hudTextDirty_ = true;
                 hudFlashLt_ = kHudFlashPeak;
                 SetHudInputFeedback(nowSeconds, "UI REQUEST PACK");
                 break;
@@ -3894,7 +7778,6 @@ private:
                     ? ProjectionMode::FrontDome
                     : ProjectionMode::FullSphere;
                 hudFlashRt_ = kHudFlashPeak;
-                hudTextDirty_ = true;
                 SetHudInputFeedback(nowSeconds,
                                     projectionMode_ == ProjectionMode::FrontDome
                                         ? "UI PROJECTION DOME"
@@ -4090,16 +7973,131 @@ private:
         const bool perfAutoSkip = readBoolProperty("debug.projectm.quest.perf.auto_skip", true);
         const bool skipMarked = readBoolProperty("debug.projectm.quest.perf.skip_marked", true);
         const bool sgsrEnabled = readBoolProperty("debug.projectm.quest.perf.sgsr", true);
-        const float renderScale = std::clamp(readFloatProperty("debug.projectm.quest.perf.render_scale",
-                                                                kDefaultProjectMRenderScale),
-                                             kMinProjectMRenderScale,
+        QualityLeverPins leverPins;
+        qualityGovernorEnabled_ = readBoolProperty("debug.projectm.quest.perf.governor", kDefaultQualityGovernorEnabled);
+        // perf.ladder overrides the ladder file, which overrides the built-in ladder.
+        std::string ladderText;
+        if (!ReadSystemProperty("debug.projectm.quest.perf.ladder", ladderText) || TrimAscii(ladderText).empty()) {
+            ladderText = qualityLadderFileText_.empty() ? std::string(kDefaultQualityLadder) : qualityLadderFileText_;
+        }
+        std::string pinText;
+        if (ReadSystemProperty("debug.projectm.quest.perf.render_scale", pinText) &&
+            ParseFloatText(pinText, leverPins.values.renderScale)) {
+            leverPins.renderScale = true;
+            leverPins.values.renderScale = std::clamp(leverPins.values.renderScale, kMinProjectMRenderScale, 1.0f);
+        }
+        if (ReadSystemProperty("debug.projectm.quest.perf.mesh", pinText) &&
+            ParseIntPairText(pinText, leverPins.values.meshWidth, leverPins.values.meshHeight)) {
+            leverPins.mesh = true;
+            leverPins.values.meshWidth = std::clamp(leverPins.values.meshWidth, 16, 128);
+            leverPins.values.meshHeight = std::clamp(leverPins.values.meshHeight, 12, 128);
+        }
+        if (ReadSystemProperty("debug.projectm.quest.perf.foveation", pinText)) {
+            leverPins.foveation = ParseFoveationLevelText(pinText, leverPins.values.foveation);
+        }
+        if (ReadSystemProperty("debug.projectm.quest.display.refresh_rate", pinText) &&
+            ParseFloatText(pinText, leverPins.values.refreshHz)) {
+            leverPins.refreshHz = true;
+            leverPins.values.refreshHz = std::clamp(leverPins.values.refreshHz, 0.0f, 144.0f);
+        }
+        char pinKey[96] = {};
+        std::snprintf(pinKey,
+                      sizeof(pinKey),
+                      "|%d%d%d%d %s",
+                      leverPins.renderScale ? 1 : 0,
+                      leverPins.mesh ? 1 : 0,
+                      leverPins.foveation ? 1 : 0,
+                      leverPins.refreshHz ? 1 : 0,
+                      FormatQualityRung(leverPins.values).c_str());
+        if (ladderText + pinKey != qualityLadderText_) {
+            qualityLadderText_ = ladderText + pinKey;
+            std::vector<QualityRung> ladder;
+            if (!ParseQualityLadderText(ladderText, ladder)) {
+                LOGW("Invalid quality ladder '%s'; using the default.", ladderText.c_str());
+                ParseQualityLadderText(kDefaultQualityLadder, ladder);
+            }
+            PinQualityLadderLevers(leverPins, ladder);
+            qualityLadder_ = std::move(ladder);
+            qualityRung_ = 0;
+            qualityLearnPending_ = false;
+            qualityFpsFloorRung_ = 0;
+            for (size_t i = 0; i < qualityLadder_.size(); ++i) {
+                LOGI("Quality rung %zu: %s", i + 1, FormatQualityRung(qualityLadder_[i]).c_str());
+            }
+        }
+        // While the governor runs, the current rung stands in for the render scale, mesh, foveation and refresh-rate
+        // properties below; any of those set explicitly were pinned on every rung above.
+        const QualityRung* governedRung = QualityGovernorActive() ? &qualityLadder_[qualityRung_] : nullptr;
+        std::string formatText;
+        RenderTargetFormat sourceFormat = RenderTargetFormat::Auto;
+        RenderTargetFormat outputFormat = RenderTargetFormat::Auto;
+        if (ReadSystemProperty("debug.projectm.quest.perf.format.source", formatText)) {
+            ParseRenderTargetFormatText(formatText, sourceFormat);
+        }
+        if (ReadSystemProperty("debug.projectm.quest.perf.format.output", formatText)) {
+            ParseRenderTargetFormatText(formatText, outputFormat);
+        }
+        std::string canvasMappingText;
+        CanvasMapping canvasMapping = CanvasMapping::Equirect;
+        if (ReadSystemProperty("debug.projectm.quest.canvas_mapping", canvasMappingText)) {
+            ParseCanvasMappingText(canvasMappingText, canvasMapping);
+        }
+        const float minRenderScale = kMinProjectMRenderScale;
+        const float renderScale = std::clamp(governedRung != nullptr
+                                                 ? QualityLadderMaxScale()
+                                                 : readFloatProperty("debug.projectm.quest.perf.render_scale",
+                                                                     kDefaultProjectMRenderScale),
+                                             minRenderScale,
                                              1.0f);
         const bool perfAutoScale = readBoolProperty("debug.projectm.quest.perf.auto_scale",
                                                      kDefaultPerfAutoScaleEnabled);
+        const bool perfAutoFoveation = readBoolProperty("debug.projectm.quest.perf.auto_foveation",
+                                                        kDefaultPerfAutoFoveationEnabled);
+        const bool foveationDynamic = readBoolProperty("debug.projectm.quest.perf.foveation.dynamic", false);
+        const bool perfAutoRefreshRate = readBoolProperty("debug.projectm.quest.perf.auto_refresh_rate",
+                                                          kDefaultPerfAutoRefreshRateEnabled);
+        const float preferredRefreshRate =
+            governedRung != nullptr
+                ? governedRung->refreshHz
+                : std::clamp(readFloatProperty("debug.projectm.quest.display.refresh_rate", 0.0f), 0.0f, 144.0f);
+        std::string spaceWarpText;
+        SpaceWarpMode spaceWarpMode = SpaceWarpMode::Auto;
+        if (ReadSystemProperty("debug.projectm.quest.perf.space_warp", spaceWarpText)) {
+            const std::string normalized = TrimAscii(spaceWarpText);
+            bool forced = false;
+            if (ParseBoolText(normalized, forced)) {
+                spaceWarpMode = forced ? SpaceWarpMode::On : SpaceWarpMode::Off;
+            }
+        }
+        const bool perfAutoCadence = readBoolProperty("debug.projectm.quest.perf.auto_cadence",
+                                                      kDefaultPerfAutoCadenceEnabled);
+        std::string cadenceText;
+        int cadenceBaseLevel = 0;
+        if (ReadSystemProperty("debug.projectm.quest.perf.projectm_cadence", cadenceText)) {
+            const std::string normalized = TrimAscii(cadenceText);
+            for (size_t i = 0; i < kProjectMCadenceLabels.size(); ++i) {
+                if (normalized == kProjectMCadenceLabels[i]) {
+                    cadenceBaseLevel = static_cast<int>(i);
+                }
+            }
+            if (normalized == "1") {
+                cadenceBaseLevel = 0;
+            }
+        }
+        const bool perfAutoEyeScale = readBoolProperty("debug.projectm.quest.perf.auto_eye_scale",
+                                                       kDefaultPerfAutoEyeScaleEnabled);
+        const float eyeScale =
+            std::clamp(readFloatProperty("debug.projectm.quest.perf.eye_scale", 1.0f),
+                       kMinEyeBufferScale,
+                       eyeBufferMaxScale_);
+        const float eyeMinScale =
+            std::clamp(readFloatProperty("debug.projectm.quest.perf.eye_min_scale", kDefaultEyeBufferMinScale),
+                       kMinEyeBufferScale,
+                       1.0f);
         const float perfAutoScaleMinRenderScale =
             std::clamp(readFloatProperty("debug.projectm.quest.perf.auto_scale.min_render_scale",
                                          kDefaultPerfAutoScaleMinRenderScale),
-                       kMinProjectMRenderScale,
+                       minRenderScale,
                        1.0f);
         const float perfAutoScaleStep =
             std::clamp(readFloatProperty("debug.projectm.quest.perf.auto_scale.step",
@@ -4126,6 +8124,25 @@ private:
                                          static_cast<float>(kDefaultPerfAutoScaleCooldownSeconds)),
                        0.1f,
                        30.0f);
+        const bool perfGpuScale = readBoolProperty("debug.projectm.quest.perf.auto_scale.gpu",
+                                                   kDefaultPerfGpuScaleEnabled);
+        const float perfGpuBudgetFraction =
+            std::clamp(readFloatProperty("debug.projectm.quest.perf.auto_scale.gpu_budget",
+                                         kDefaultPerfGpuBudgetFraction),
+                       0.5f,
+                       1.0f);
+        perfWatchdogEnabled_ = readBoolProperty("debug.projectm.quest.perf.watchdog", kDefaultPerfWatchdogEnabled);
+        projectMWatchdogDeadlineMs_.store(
+            perfWatchdogEnabled_
+                ? std::clamp(readFloatProperty("debug.projectm.quest.perf.watchdog.deadline_ms",
+                                               kDefaultPerfWatchdogDeadlineMs),
+                             20.0f,
+                             1000.0f)
+                : 0.0f);
+        perfWatchdogOverruns_ = static_cast<int>(std::lround(std::clamp(
+            readFloatProperty("debug.projectm.quest.perf.watchdog.overruns", kDefaultPerfWatchdogOverruns),
+            1.0f,
+            20.0f)));
         const float perfMinFps = std::clamp(readFloatProperty("debug.projectm.quest.perf.min_fps", kDefaultPerfAutoSkipMinFps), 15.0f, 90.0f);
         const float perfHold = std::clamp(readFloatProperty("debug.projectm.quest.perf.bad_seconds",
                                                             static_cast<float>(kDefaultPerfAutoSkipHoldSeconds)),
@@ -4168,126 +8185,877 @@ private:
             hudEnabled_ = hudEnabled;
             hudChanged = true;
         }
-        if (std::fabs(hudDistance_ - hudDistance) > 0.0005f) {
-            hudDistance_ = hudDistance;
-            hudChanged = true;
+        if (std::fabs(hudDistance_ - hudDistance) > 0.0005f) {
+            hudDistance_ = hudDistance;
+            hudChanged = true;
+        }
+        if (std::fabs(hudVerticalOffset_ - hudVerticalOffset) > 0.0005f) {
+            hudVerticalOffset_ = hudVerticalOffset;
+            hudChanged = true;
+        }
+        if (std::fabs(hudWidth_ - newHudWidth) > 0.0005f) {
+            hudWidth_ = newHudWidth;
+            hudChanged = true;
+        }
+        if (std::fabs(hudHeight_ - newHudHeight) > 0.0005f) {
+            hudHeight_ = newHudHeight;
+            hudChanged = true;
+        }
+
+        if (hudChanged) {
+            ExtendHudVisibility(nowSeconds, kHudVisibleAfterStatusChangeSeconds);
+            LOGI("HUD tuning updated: enabled=%d distance=%.2f vOffset=%.2f scale=%.2f",
+                 hudEnabled_ ? 1 : 0,
+                 hudDistance_,
+                 hudVerticalOffset_,
+                 hudScale);
+        }
+
+        perfAutoSkipEnabled_ = perfAutoSkip;
+        skipMarkedPresets_ = skipMarked;
+        perfAutoSkipMinFps_ = perfMinFps;
+        perfAutoSkipHoldSeconds_ = static_cast<double>(perfHold);
+        perfAutoSkipCooldownSeconds_ = static_cast<double>(perfCooldown);
+        perfAutoScaleEnabled_ = perfAutoScale;
+        perfAutoFoveationEnabled_ = perfAutoFoveation;
+        perfAutoEyeScaleEnabled_ = perfAutoEyeScale;
+        perfAutoRefreshRateEnabled_ = perfAutoRefreshRate;
+        if (perfAutoCadenceEnabled_ != perfAutoCadence || projectMCadenceBaseLevel_ != cadenceBaseLevel) {
+            perfAutoCadenceEnabled_ = perfAutoCadence;
+            projectMCadenceBaseLevel_ = cadenceBaseLevel;
+            if (!perfAutoCadenceEnabled_) {
+                presetCadenceLevels_.clear();
+            }
+            ApplyPresetCadenceLevel();
+        }
+        if (spaceWarpMode_ != spaceWarpMode) {
+            spaceWarpMode_ = spaceWarpMode;
+            spaceWarpEngaged_ = false;
+            LOGI("SpaceWarp mode: %s",
+                 spaceWarpMode_ == SpaceWarpMode::On ? "on" : (spaceWarpMode_ == SpaceWarpMode::Off ? "off" : "auto"));
+        }
+        if (!perfAutoRefreshRateEnabled_ || governedRung != nullptr) {
+            refreshRateDropSteps_ = 0;
+        }
+        if (std::fabs(preferredDisplayRefreshRate_ - preferredRefreshRate) > 0.5f) {
+            preferredDisplayRefreshRate_ = preferredRefreshRate;
+            refreshRateDropSteps_ = 0;
+        }
+        ApplyDisplayRefreshRateIfNeeded();
+        perfEyeBufferMinScale_ = std::min(eyeMinScale, eyeScale);
+        if (std::fabs(eyeBufferScale_ - eyeScale) > 0.0005f) {
+            eyeBufferScale_ = eyeScale;
+            eyeBufferAdaptiveScale_ = eyeScale;
+            lowFpsForAutoScaleSinceSeconds_ = -1.0;
+            highFpsForAutoScaleSinceSeconds_ = -1.0;
+            LOGI("Eye buffer scale set to %.2f", eyeBufferScale_);
+        }
+        if (!perfAutoEyeScaleEnabled_) {
+            eyeBufferAdaptiveScale_ = eyeBufferScale_;
+        }
+        perfAutoScaleMinRenderScale_ = std::clamp(std::min(perfAutoScaleMinRenderScale, renderScale),
+                                                  minRenderScale,
+                                                  1.0f);
+        perfAutoScaleStep_ = perfAutoScaleStep;
+        perfAutoScaleDownFps_ = perfAutoScaleDownFps;
+        perfAutoScaleUpFps_ = std::clamp(std::max(perfAutoScaleUpFps, perfAutoScaleDownFps_ + 0.5f), 20.0f, 90.0f);
+        perfAutoScaleHoldSeconds_ = static_cast<double>(perfAutoScaleHold);
+        perfAutoScaleCooldownSeconds_ = static_cast<double>(perfAutoScaleCooldown);
+        perfGpuScaleEnabled_ = perfGpuScale;
+        perfGpuBudgetFraction_ = perfGpuBudgetFraction;
+        perfSlowPresetRetryCooldownSeconds_ = static_cast<double>(perfSlowRetryCooldown);
+        perfSlowPresetRetryProbeIntervalSeconds_ = static_cast<double>(perfSlowRetryProbeInterval);
+        perfSlowPresetRetryWarmupSeconds_ = static_cast<double>(perfSlowRetryWarmup);
+        perfRepeatSlowSkipHoldScale_ = static_cast<double>(perfRepeatSlowHoldScale);
+        perfRepeatSlowSkipMinHoldSeconds_ = static_cast<double>(perfRepeatSlowMinHold);
+
+        bool renderConfigChanged = false;
+        if (sgsrEnabled_ != sgsrEnabled) {
+            sgsrEnabled_ = sgsrEnabled;
+            renderConfigChanged = true;
+        }
+        if (canvasMappingSetting_ != canvasMapping) {
+            canvasMappingSetting_ = canvasMapping;
+            LOGI("Canvas mapping: %s", CanvasMappingLabel(canvasMappingSetting_));
+            renderConfigChanged = true;
+        }
+        if (sourceFormatSetting_ != sourceFormat || outputFormatSetting_ != outputFormat) {
+            sourceFormatSetting_ = sourceFormat;
+            outputFormatSetting_ = outputFormat;
+            renderConfigChanged = true;
+        }
+        if (std::fabs(projectMRenderScale_ - renderScale) > 0.0005f) {
+            projectMRenderScale_ = renderScale;
+            projectMAdaptiveRenderScale_ = projectMRenderScale_;
+            lowFpsForAutoScaleSinceSeconds_ = -1.0;
+            highFpsForAutoScaleSinceSeconds_ = -1.0;
+            renderConfigChanged = true;
+        }
+        // The governor pins the adaptive scale to the rung; otherwise it only moves with auto-scale enabled.
+        const float pinnedAdaptiveScale =
+            governedRung != nullptr ? std::clamp(governedRung->renderScale, minRenderScale, renderScale)
+                                    : projectMRenderScale_;
+        if ((governedRung != nullptr || !perfAutoScaleEnabled_) &&
+            std::fabs(projectMAdaptiveRenderScale_ - pinnedAdaptiveScale) > 0.0005f) {
+            projectMAdaptiveRenderScale_ = pinnedAdaptiveScale;
+            renderConfigChanged = true;
+        }
+        if (renderConfigChanged && projectM_ != nullptr) {
+            if (!ApplyProjectMRenderConfiguration()) {
+                LOGE("Failed to apply runtime render scaling update.");
+                exitRenderLoop_ = true;
+            } else {
+                SetHudInputFeedback(nowSeconds, projectMUseUpscaler_ ? "SGSR SCALE UPDATED" : "RENDER SCALE UPDATED");
+                ExtendHudVisibility(nowSeconds, kHudVisibleAfterStatusChangeSeconds);
+            }
+        }
+
+        std::string meshText;
+        int parsedMeshWidth = kDefaultMeshWidth;
+        int parsedMeshHeight = kDefaultMeshHeight;
+        if (ReadSystemProperty("debug.projectm.quest.perf.mesh", meshText) &&
+            ParseIntPairText(meshText, parsedMeshWidth, parsedMeshHeight)) {
+            parsedMeshWidth = std::clamp(parsedMeshWidth, 16, 128);
+            parsedMeshHeight = std::clamp(parsedMeshHeight, 12, 128);
+        } else {
+            parsedMeshWidth = kDefaultMeshWidth;
+            parsedMeshHeight = kDefaultMeshHeight;
+        }
+        if (governedRung != nullptr) {
+            parsedMeshWidth = governedRung->meshWidth;
+            parsedMeshHeight = governedRung->meshHeight;
+        }
+
+        const bool autoMesh = readBoolProperty("debug.projectm.quest.perf.auto_mesh", kDefaultPerfAutoMeshEnabled);
+        perfMeshCpuBudgetFraction_ = std::clamp(
+            readFloatProperty("debug.projectm.quest.perf.mesh.cpu_budget", kDefaultPerfMeshCpuBudgetFraction),
+            0.2f,
+            1.0f);
+
+        if ((meshCapWidth_ != parsedMeshWidth || meshCapHeight_ != parsedMeshHeight ||
+             perfAutoMeshEnabled_ != autoMesh) &&
+            projectM_ != nullptr) {
+            meshCapWidth_ = parsedMeshWidth;
+            meshCapHeight_ = parsedMeshHeight;
+            perfAutoMeshEnabled_ = autoMesh;
+            ApplyCurrentPresetMeshSize();
+            hudInputFeedbackLabel_ = "QUALITY MESH UPDATED";
+            hudInputFeedbackUntilSeconds_ = nowSeconds + kHudInputFeedbackSeconds;
+            ExtendHudVisibility(nowSeconds, kHudVisibleAfterStatusChangeSeconds);
+        }
+
+        std::string foveationText;
+        FoveationLevel parsedFoveationLevel = kDefaultFoveationLevel;
+        if (!ReadSystemProperty("debug.projectm.quest.perf.foveation", foveationText) ||
+            !ParseFoveationLevelText(foveationText, parsedFoveationLevel)) {
+            parsedFoveationLevel = kDefaultFoveationLevel;
+        }
+        if (governedRung != nullptr) {
+            parsedFoveationLevel = governedRung->foveation;
+        }
+        if (!perfAutoFoveationEnabled_ || governedRung != nullptr) {
+            foveationAutoBoost_ = 0;
+        }
+        if (foveationLevel_ != parsedFoveationLevel || foveationDynamic_ != foveationDynamic) {
+            foveationLevel_ = parsedFoveationLevel;
+            foveationDynamic_ = foveationDynamic;
+            foveationAutoBoost_ = 0;
+            if (foveationReady_) {
+                SetHudInputFeedback(nowSeconds, "FOVEATION UPDATED");
+                ExtendHudVisibility(nowSeconds, kHudVisibleAfterStatusChangeSeconds);
+            }
+        }
+        ApplyFoveationProfileIfNeeded();
+
+        std::string captureText;
+        CaptureMode parsedCaptureMode = CaptureMode::Off;
+        if (ReadSystemProperty("debug.projectm.quest.capture", captureText)) {
+            ParseCaptureModeText(captureText, parsedCaptureMode);
+        }
+        captureIntervalSeconds_ = static_cast<double>(std::clamp(
+            readFloatProperty("debug.projectm.quest.capture.interval", static_cast<float>(kDefaultCaptureIntervalSeconds)),
+            0.05f,
+            60.0f));
+        captureMaxFrames_ = static_cast<int>(std::lround(std::clamp(
+            readFloatProperty("debug.projectm.quest.capture.max_frames", kDefaultCaptureMaxFrames), 1.0f, 100000.0f)));
+        if (parsedCaptureMode != captureMode_) {
+            SetCaptureMode(nowSeconds, parsedCaptureMode);
+        }
+
+        std::string transitionText;
+        PresetTransitionMode parsedTransitionMode = PresetTransitionMode::Auto;
+        if (!ReadSystemProperty("debug.projectm.quest.perf.transition", transitionText) ||
+            !ParsePresetTransitionModeText(transitionText, parsedTransitionMode)) {
+            parsedTransitionMode = PresetTransitionMode::Auto;
+        }
+        presetTransitionMode_ = parsedTransitionMode;
+
+        std::string idleText;
+        IdleThrottle parsedUnfocusedThrottle = IdleThrottle::Reduced;
+        if (!ReadSystemProperty("debug.projectm.quest.perf.idle.unfocused", idleText) ||
+            !ParseIdleThrottleText(idleText, parsedUnfocusedThrottle)) {
+            parsedUnfocusedThrottle = IdleThrottle::Reduced;
+        }
+        IdleThrottle parsedAbsentThrottle = IdleThrottle::Frozen;
+        if (!ReadSystemProperty("debug.projectm.quest.perf.idle.absent", idleText) ||
+            !ParseIdleThrottleText(idleText, parsedAbsentThrottle)) {
+            parsedAbsentThrottle = IdleThrottle::Frozen;
+        }
+        idleUnfocusedThrottle_ = parsedUnfocusedThrottle;
+        idleAbsentThrottle_ = parsedAbsentThrottle;
+        idleThrottleRate_ =
+            std::clamp(readFloatProperty("debug.projectm.quest.perf.idle.rate", kDefaultIdleThrottleRate), 0.05f, 1.0f);
+
+        const bool clearMarkedRequest = readBoolProperty("debug.projectm.quest.perf.clear_marked", false);
+        if (clearMarkedRequest && !clearMarkedLatch_) {
+            ClearSlowPresetMarks();
+            clearMarkedLatch_ = true;
+            hudInputFeedbackLabel_ = "CLEARED SLOW PRESET MARKS";
+            hudInputFeedbackUntilSeconds_ = nowSeconds + kHudInputFeedbackSeconds;
+            ExtendHudVisibility(nowSeconds, kHudVisibleAfterStatusChangeSeconds);
+        }
+        if (!clearMarkedRequest) {
+            clearMarkedLatch_ = false;
+        }
+    }
+
+    void SetProjectMMeshSize(int meshWidth, int meshHeight) {
+        meshWidth_ = meshWidth;
+        meshHeight_ = meshHeight;
+        lastMeshChangeSeconds_ = ElapsedSeconds();
+        meshUpgradeSinceSeconds_ = -1.0;
+        PostProjectMJob([this, meshWidth, meshHeight]() {
+            ApplyProjectMMeshSize(meshWidth, meshHeight);
+            ResetProjectMPassSamples();
+        });
+        LOGI("projectM mesh size set to %d x %d", meshWidth_, meshHeight_);
+    }
+
+    // Sizes the mesh governor may use under the current cap (the rung's or perf.mesh size), smallest first;
+    // the cap itself is always the last entry.
+    std::vector<std::pair<int, int>> MeshSizeCandidates() const {
+        std::vector<std::pair<int, int>> candidates;
+        for (const auto& size : kProjectMMeshSizes) {
+            if (size.first < meshCapWidth_ && size.second < meshCapHeight_) {
+                candidates.push_back(size);
+            }
+        }
+        candidates.emplace_back(meshCapWidth_, meshCapHeight_);
+        return candidates;
+    }
+
+    std::pair<int, int> PresetMeshSize(const std::string& presetPath) const {
+        if (!perfAutoMeshEnabled_) {
+            return {meshCapWidth_, meshCapHeight_};
+        }
+        const auto it = presetMeshSizes_.find(PresetHistoryKey(presetPath));
+        if (it == presetMeshSizes_.end() || it->second.first >= meshCapWidth_) {
+            return {meshCapWidth_, meshCapHeight_};
+        }
+        // The largest candidate no bigger than the remembered size.
+        std::pair<int, int> chosen = MeshSizeCandidates().front();
+        for (const auto& candidate : MeshSizeCandidates()) {
+            if (candidate.first <= it->second.first) {
+                chosen = candidate;
+            }
+        }
+        return chosen;
+    }
+
+    // Re-applies the current preset's mesh after the cap or the auto-mesh setting changed.
+    void ApplyCurrentPresetMeshSize() {
+        if (projectM_ == nullptr) {
+            return;
+        }
+        const std::pair<int, int> mesh =
+            !usingFallbackPreset_ && currentPresetIndex_ < presetFiles_.size()
+                ? PresetMeshSize(presetFiles_[currentPresetIndex_])
+                : std::make_pair(meshCapWidth_, meshCapHeight_);
+        if (mesh.first != meshWidth_ || mesh.second != meshHeight_) {
+            SetProjectMMeshSize(mesh.first, mesh.second);
+        }
+    }
+
+    // projectM evaluates the per-vertex equations on the CPU, once per mesh vertex, so its CPU time per frame is
+    // predicted to scale with the vertex count. Picks the largest mesh whose predicted p95 fits the projectM frame
+    // interval and remembers it for the preset. Returns true when the mesh changed.
+    bool UpdatePresetMeshSize(double nowSeconds) {
+        if (!perfAutoMeshEnabled_ || usingFallbackPreset_ || currentPresetIndex_ >= presetFiles_.size() ||
+            nowSeconds - lastMeshChangeSeconds_ < kMeshSettleSeconds || activeDisplayRefreshRate_ <= 0.0f) {
+            return false;
+        }
+        const ProjectMCpuStats cpu = SnapshotProjectMCpuStats();
+        if (cpu.render.samples < kGpuScaleMinSamples || cpu.meshWidth != meshWidth_ ||
+            cpu.meshHeight != meshHeight_ || cpu.render.p95Ms <= 0.0f) {
+            return false;
+        }
+
+        const std::vector<std::pair<int, int>> candidates = MeshSizeCandidates();
+        size_t current = candidates.size() - 1;
+        for (size_t i = 0; i < candidates.size(); ++i) {
+            if (candidates[i].first == meshWidth_ && candidates[i].second == meshHeight_) {
+                current = i;
+            }
+        }
+        const double cadenceRatio =
+            static_cast<double>(kProjectMCadenceRatios[static_cast<size_t>(projectMCadenceLevel_)]);
+        const double intervalMs =
+            (spaceWarpSubmitting_ ? 2000.0 : 1000.0) / static_cast<double>(activeDisplayRefreshRate_) / cadenceRatio;
+        const double budgetMs = intervalMs * static_cast<double>(perfMeshCpuBudgetFraction_);
+        const double currentVertices = static_cast<double>(meshWidth_ * meshHeight_);
+        auto predictMs = [&](const std::pair<int, int>& mesh) {
+            return static_cast<double>(cpu.render.p95Ms) * static_cast<double>(mesh.first * mesh.second) / currentVertices;
+        };
+        size_t best = 0;
+        for (size_t i = candidates.size(); i-- > 0;) {
+            const double margin = i > current ? 1.0 - static_cast<double>(kMeshUpgradeMargin) : 1.0;
+            if (predictMs(candidates[i]) <= budgetMs * margin) {
+                best = i;
+                break;
+            }
+        }
+        if (best == current) {
+            meshUpgradeSinceSeconds_ = -1.0;
+            return false;
+        }
+        if (best > current) {
+            if (meshUpgradeSinceSeconds_ < 0.0) {
+                meshUpgradeSinceSeconds_ = nowSeconds;
+                return false;
+            }
+            if (nowSeconds - meshUpgradeSinceSeconds_ < kMeshUpgradeHoldSeconds) {
+                return false;
+            }
+        }
+
+        const std::pair<int, int> mesh = candidates[best];
+        LOGI("Preset mesh %s: %d x %d -> %d x %d (projectM CPU p95 %.2fms, predicted %.2fms, budget %.2fms)",
+             best < current ? "down" : "up",
+             meshWidth_,
+             meshHeight_,
+             mesh.first,
+             mesh.second,
+             static_cast<double>(cpu.render.p95Ms),
+             predictMs(mesh),
+             budgetMs);
+        SetProjectMMeshSize(mesh.first, mesh.second);
+        const std::string key = PresetHistoryKey(presetFiles_[currentPresetIndex_]);
+        if (best + 1 == candidates.size()) {
+            presetMeshSizes_.erase(key);
+        } else {
+            presetMeshSizes_[key] = mesh;
+        }
+        PersistPresetMeshSizes();
+        SetHudInputFeedback(nowSeconds, best < current ? "AUTO MESH DOWN" : "AUTO MESH UP");
+        return true;
+    }
+
+    void SetHudInputFeedback(double nowSeconds, const std::string& feedbackLabel) {
+        hudInputFeedbackLabel_ = feedbackLabel;
+        hudInputFeedbackUntilSeconds_ = nowSeconds + kHudInputFeedbackSeconds;
+    }
+
+    bool QualityGovernorActive() const {
+        return qualityGovernorEnabled_ && !qualityLadder_.empty() && projectM_ != nullptr;
+    }
+
+    float QualityLadderMaxScale() const {
+        float maxScale = 0.0f;
+        for (const QualityRung& rung : qualityLadder_) {
+            maxScale = std::max(maxScale, rung.renderScale);
+        }
+        return maxScale;
+    }
+
+    double QualityRungBudgetMs(const QualityRung& rung) const {
+        float refreshRate = activeDisplayRefreshRate_;
+        if (!supportedDisplayRefreshRates_.empty()) {
+            refreshRate = supportedDisplayRefreshRates_[static_cast<size_t>(SupportedRefreshRateIndex(rung.refreshHz))];
+        }
+        const double frameMs = (spaceWarpSubmitting_ ? 2000.0 : 1000.0) / std::max(static_cast<double>(refreshRate), 1.0);
+        return frameMs * static_cast<double>(perfGpuBudgetFraction_);
+    }
+
+    // The source target is sized for the ladder's largest scale, so moving between rungs only changes the
+    // viewport (and the upscaler pass), never reallocates.
+    bool ApplyQualityRung(size_t index) {
+        const QualityRung& rung = qualityLadder_[index];
+        qualityRung_ = index;
+        const float minScale = MinProjectMRenderScale();
+        projectMRenderScale_ = std::clamp(QualityLadderMaxScale(), minScale, 1.0f);
+        projectMAdaptiveRenderScale_ = std::clamp(rung.renderScale, minScale, projectMRenderScale_);
+        if (!ApplyProjectMRenderConfiguration()) {
+            LOGE("Failed to apply quality rung %zu.", index);
+            exitRenderLoop_ = true;
+            return false;
+        }
+        meshCapWidth_ = rung.meshWidth;
+        meshCapHeight_ = rung.meshHeight;
+        ApplyCurrentPresetMeshSize();
+        foveationLevel_ = rung.foveation;
+        foveationAutoBoost_ = 0;
+        ApplyFoveationProfileIfNeeded();
+        preferredDisplayRefreshRate_ = rung.refreshHz;
+        refreshRateDropSteps_ = 0;
+        ApplyDisplayRefreshRateIfNeeded();
+        return true;
+    }
+
+    // Picks the best-looking rung whose predicted GPU time fits the frame budget. Predictions scale the time
+    // measured on the current rung by the rungs' relative costs, and each move refines the relative cost of the
+    // rung it lands on. Without timer queries it steps one rung at a time on the FPS thresholds instead.
+    // Returns true when the rung changed.
+    bool UpdateQualityGovernor(double nowSeconds, bool wantQualityDown, bool wantQualityUp, bool extrasEngaged) {
+        if (nowSeconds - qualityRungChangedSeconds_ < kQualityGovernorSettleSeconds) {
+            return false;
+        }
+        const size_t current = qualityRung_;
+        const size_t lastRung = qualityLadder_.size() - 1;
+        if (wantQualityDown) {
+            if (qualityLowFpsSinceSeconds_ < 0.0) {
+                qualityLowFpsSinceSeconds_ = nowSeconds;
+            }
+        } else {
+            qualityLowFpsSinceSeconds_ = -1.0;
+        }
+        const bool lowFpsHeld =
+            qualityLowFpsSinceSeconds_ >= 0.0 && nowSeconds - qualityLowFpsSinceSeconds_ >= perfAutoScaleHoldSeconds_;
+
+        const std::array<GpuPassStats, kGpuPassCount> stats = SnapshotGpuPassStats();
+        const GpuPassStats& projectMGpu = stats[static_cast<size_t>(GpuPass::ProjectM)];
+        const GpuPassStats& eyeGpu = stats[static_cast<size_t>(GpuPass::Eye)];
+        const bool measured = glGetQueryObjectui64vEXT_ != nullptr &&
+                              projectMGpu.samples >= kGpuScaleMinSamples &&
+                              projectMGpu.renderPixels == static_cast<uint32_t>(projectMRenderWidth_ * projectMRenderHeight_) &&
+                              eyeGpu.samples > 0;
+        if (!measured) {
+            if (lowFpsHeld && current < lastRung) {
+                return MoveQualityRung(nowSeconds, current + 1, "low fps", 0.0, 0.0, 0.0, 0.0);
+            }
+            if (!wantQualityUp || extrasEngaged || current == 0) {
+                qualityUpgradeSinceSeconds_ = -1.0;
+                return false;
+            }
+            // A higher refresh rate can't show headroom in display-paced FPS, so probe it only after a long hold.
+            const bool raisesRefresh = qualityLadder_[current - 1].refreshHz > qualityLadder_[current].refreshHz + 0.5f;
+            const double holdSeconds =
+                std::max(perfAutoScaleHoldSeconds_, raisesRefresh ? kRefreshRateRaiseHoldSeconds : kQualityUpgradeHoldSeconds);
+            if (qualityUpgradeSinceSeconds_ < 0.0) {
+                qualityUpgradeSinceSeconds_ = nowSeconds;
+                return false;
+            }
+            if (nowSeconds - qualityUpgradeSinceSeconds_ < holdSeconds) {
+                return false;
+            }
+            return MoveQualityRung(nowSeconds, current - 1, "high fps", 0.0, 0.0, 0.0, 0.0);
+        }
+
+        const double viewCount = static_cast<double>(std::max<size_t>(xrViews_.size(), 1));
+        const double eyeMs = viewCount * static_cast<double>(eyeGpu.avgMs +
+                                                             stats[static_cast<size_t>(GpuPass::Hud)].avgMs +
+                                                             stats[static_cast<size_t>(GpuPass::Hands)].avgMs);
+        const double projectMMs =
+            static_cast<double>(projectMGpu.p95Ms) +
+            (projectMUseUpscaler_ ? static_cast<double>(stats[static_cast<size_t>(GpuPass::Upscale)].p95Ms) : 0.0);
+
+        // Learn the relative cost of the rung we just moved to from the times measured before and after the move,
+        // as long as the preset (and so the content) stayed the same in between.
+        if (qualityLearnPending_ && lastPresetSwitchSeconds_ < qualityRungChangedSeconds_) {
+            const QualityRung& from = qualityLadder_[qualityLearnFromRung_];
+            QualityRung& rung = qualityLadder_[current];
+            const float observedProjectMCost =
+                from.projectMCost * static_cast<float>(projectMMs / qualityLearnProjectMMs_);
+            const float observedEyeCost = from.eyeCost * static_cast<float>(eyeMs / qualityLearnEyeMs_);
+            rung.projectMCost += (observedProjectMCost - rung.projectMCost) * kQualityCostLearnRate;
+            rung.eyeCost += (observedEyeCost - rung.eyeCost) * kQualityCostLearnRate;
+            LOGI("Quality rung %zu cost learned: projectM %.3f eye %.3f (from rung %zu)",
+                 current + 1,
+                 static_cast<double>(rung.projectMCost),
+                 static_cast<double>(rung.eyeCost),
+                 qualityLearnFromRung_ + 1);
+        }
+        qualityLearnPending_ = false;
+
+        const QualityRung& currentRung = qualityLadder_[current];
+        const double cadenceRatio =
+            static_cast<double>(kProjectMCadenceRatios[static_cast<size_t>(projectMCadenceLevel_)]);
+        auto predictMs = [&](const QualityRung& rung) {
+            return eyeMs * static_cast<double>(rung.eyeCost / currentRung.eyeCost) +
+                   cadenceRatio * projectMMs * static_cast<double>(rung.projectMCost / currentRung.projectMCost);
+        };
+        // A rung that was dropped for low FPS the timers could not explain (CPU or compositor) stays off limits
+        // until the preset changes.
+        const size_t floorRung =
+            lastPresetSwitchSeconds_ < qualityFpsFloorSetSeconds_ ? std::min(qualityFpsFloorRung_, lastRung) : 0;
+        // Climbing needs headroom beyond the measured noise so one spiky window doesn't bounce between rungs.
+        const double upgradeMargin = std::clamp(
+            2.0 * static_cast<double>(projectMGpu.stddevMs) / std::max(static_cast<double>(projectMGpu.avgMs), 0.01),
+            static_cast<double>(kQualityMinUpgradeMargin),
+            static_cast<double>(kQualityMaxUpgradeMargin));
+        size_t best = lastRung;
+        for (size_t i = floorRung; i < qualityLadder_.size(); ++i) {
+            const double margin = i < current ? 1.0 - upgradeMargin : 1.0;
+            if (predictMs(qualityLadder_[i]) <= QualityRungBudgetMs(qualityLadder_[i]) * margin) {
+                best = i;
+                break;
+            }
+        }
+        const double currentPredictedMs = predictMs(currentRung);
+
+        if (best > current) {
+            return MoveQualityRung(nowSeconds,
+                                   best,
+                                   "over budget",
+                                   projectMMs,
+                                   eyeMs,
+                                   currentPredictedMs,
+                                   predictMs(qualityLadder_[best]));
+        }
+        if (lowFpsHeld && current < lastRung) {
+            qualityFpsFloorRung_ = current + 1;
+            qualityFpsFloorSetSeconds_ = nowSeconds;
+            return MoveQualityRung(nowSeconds,
+                                   current + 1,
+                                   "low fps within gpu budget",
+                                   projectMMs,
+                                   eyeMs,
+                                   currentPredictedMs,
+                                   predictMs(qualityLadder_[current + 1]));
+        }
+        if (best == current || extrasEngaged || wantQualityDown) {
+            qualityUpgradeSinceSeconds_ = -1.0;
+            return false;
         }
-        if (std::fabs(hudVerticalOffset_ - hudVerticalOffset) > 0.0005f) {
-            hudVerticalOffset_ = hudVerticalOffset;
-            hudChanged = true;
+        if (qualityUpgradeSinceSeconds_ < 0.0) {
+            qualityUpgradeSinceSeconds_ = nowSeconds;
+            return false;
         }
-        if (std::fabs(hudWidth_ - newHudWidth) > 0.0005f) {
-            hudWidth_ = newHudWidth;
-            hudChanged = true;
+        if (nowSeconds - qualityUpgradeSinceSeconds_ < kQualityUpgradeHoldSeconds) {
+            return false;
         }
-        if (std::fabs(hudHeight_ - newHudHeight) > 0.0005f) {
-            hudHeight_ = newHudHeight;
-            hudChanged = true;
+        return MoveQualityRung(nowSeconds,
+                               best,
+                               "headroom",
+                               projectMMs,
+                               eyeMs,
+                               currentPredictedMs,
+                               predictMs(qualityLadder_[best]));
+    }
+
+    // projectMMs/eyeMs are the times measured on the rung being left (zero when the move came from FPS alone);
+    // they seed the cost learning once the new rung has been measured.
+    bool MoveQualityRung(double nowSeconds,
+                         size_t target,
+                         const char* reason,
+                         double projectMMs,
+                         double eyeMs,
+                         double currentPredictedMs,
+                         double targetPredictedMs) {
+        const size_t from = qualityRung_;
+        if (!ApplyQualityRung(target)) {
+            return true;
         }
-
-        if (hudChanged) {
-            ExtendHudVisibility(nowSeconds, kHudVisibleAfterStatusChangeSeconds);
-            LOGI("HUD tuning updated: enabled=%d distance=%.2f vOffset=%.2f scale=%.2f",
-                 hudEnabled_ ? 1 : 0,
-                 hudDistance_,
-                 hudVerticalOffset_,
-                 hudScale);
+        qualityRungChangedSeconds_ = nowSeconds;
+        qualityUpgradeSinceSeconds_ = -1.0;
+        qualityLowFpsSinceSeconds_ = -1.0;
+        qualityLearnPending_ = projectMMs > 0.0 && eyeMs > 0.0;
+        qualityLearnFromRung_ = from;
+        qualityLearnProjectMMs_ = projectMMs;
+        qualityLearnEyeMs_ = eyeMs;
+        lowFpsForAutoScaleSinceSeconds_ = -1.0;
+        highFpsForAutoScaleSinceSeconds_ = -1.0;
+        lastAutoScaleAdjustSeconds_ = nowSeconds;
+        const bool down = target > from;
+        SetHudInputFeedback(nowSeconds, down ? "AUTO QUALITY DOWN" : "AUTO QUALITY UP");
+        if (projectMMs > 0.0) {
+            LOGI("Quality governor %s (%s): rung %zu -> %zu [%s] predicted %.2f -> %.2f ms, budget %.2f ms (projectM %.2f eye %.2f)",
+                 down ? "down" : "up",
+                 reason,
+                 from + 1,
+                 target + 1,
+                 FormatQualityRung(qualityLadder_[target]).c_str(),
+                 currentPredictedMs,
+                 targetPredictedMs,
+                 QualityRungBudgetMs(qualityLadder_[target]),
+                 projectMMs,
+                 eyeMs);
+        } else {
+            LOGI("Quality governor %s (%s): rung %zu -> %zu [%s]",
+                 down ? "down" : "up",
+                 reason,
+                 from + 1,
+                 target + 1,
+                 FormatQualityRung(qualityLadder_[target]).c_str());
         }
+        return true;
+    }
 
-        perfAutoSkipEnabled_ = perfAutoSkip;
-        skipMarkedPresets_ = skipMarked;
-        perfAutoSkipMinFps_ = perfMinFps;
-        perfAutoSkipHoldSeconds_ = static_cast<double>(perfHold);
-        perfAutoSkipCooldownSeconds_ = static_cast<double>(perfCooldown);
-        perfAutoScaleEnabled_ = perfAutoScale;
-        perfAutoScaleMinRenderScale_ = std::clamp(std::min(perfAutoScaleMinRenderScale, renderScale),
-                                                  kMinProjectMRenderScale,
-                                                  1.0f);
-        perfAutoScaleStep_ = perfAutoScaleStep;
-        perfAutoScaleDownFps_ = perfAutoScaleDownFps;
-        perfAutoScaleUpFps_ = std::clamp(std::max(perfAutoScaleUpFps, perfAutoScaleDownFps_ + 0.5f), 20.0f, 90.0f);
-        perfAutoScaleHoldSeconds_ = static_cast<double>(perfAutoScaleHold);
-        perfAutoScaleCooldownSeconds_ = static_cast<double>(perfAutoScaleCooldown);
-        perfSlowPresetRetryCooldownSeconds_ = static_cast<double>(perfSlowRetryCooldown);
-        perfSlowPresetRetryProbeIntervalSeconds_ = static_cast<double>(perfSlowRetryProbeInterval);
-        perfSlowPresetRetryWarmupSeconds_ = static_cast<double>(perfSlowRetryWarmup);
-        perfRepeatSlowSkipHoldScale_ = static_cast<double>(perfRepeatSlowHoldScale);
-        perfRepeatSlowSkipMinHoldSeconds_ = static_cast<double>(perfRepeatSlowMinHold);
+    // projectM cost scales roughly with its pixel count, so the scale that fits the GPU budget is predicted from the
+    // measured p95 time and applied in one jump. The deadband follows the measured variance so noisy presets do
+    // not oscillate. Returns true when the render scale changed (or the reconfiguration failed).
+    bool UpdateGpuRenderScaleController(double nowSeconds, float minAdaptiveScale) {
+        if (nowSeconds - lastAutoScaleAdjustSeconds_ < kGpuScaleSettleSeconds || activeDisplayRefreshRate_ <= 0.0f) {
+            return false;
+        }
+        const std::array<GpuPassStats, kGpuPassCount> stats = SnapshotGpuPassStats();
+        const GpuPassStats& projectMGpu = stats[static_cast<size_t>(GpuPass::ProjectM)];
+        const GpuPassStats& upscaleGpu = stats[static_cast<size_t>(GpuPass::Upscale)];
+        const uint32_t renderPixels = static_cast<uint32_t>(projectMRenderWidth_ * projectMRenderHeight_);
+        // Wait for a full-enough window measured at the current render size.
+        if (projectMGpu.samples < kGpuScaleMinSamples || projectMGpu.renderPixels != renderPixels ||
+            projectMGpu.p95Ms <= 0.0f) {
+            return false;
+        }
 
-        bool renderConfigChanged = false;
-        if (sgsrEnabled_ != sgsrEnabled) {
-            sgsrEnabled_ = sgsrEnabled;
-            renderConfigChanged = true;
+        // Per display frame: eye-buffer passes for every view, plus projectM and the upscaler amortized over the
+        // cadence (only that fraction of display frames produces a projectM frame).
+        const double frameMs = (spaceWarpSubmitting_ ? 2000.0 : 1000.0) / static_cast<double>(activeDisplayRefreshRate_);
+        const double budgetMs = frameMs * static_cast<double>(perfGpuBudgetFraction_);
+        const double viewCount = static_cast<double>(std::max<size_t>(xrViews_.size(), 1));
+        const double eyeMs = viewCount * static_cast<double>(stats[static_cast<size_t>(GpuPass::Eye)].avgMs +
+                                                             stats[static_cast<size_t>(GpuPass::Hud)].avgMs +
+                                                             stats[static_cast<size_t>(GpuPass::Hands)].avgMs);
+        const double cadenceRatio =
+            static_cast<double>(kProjectMCadenceRatios[static_cast<size_t>(projectMCadenceLevel_)]);
+        const double targetMs =
+            (budgetMs - eyeMs) / cadenceRatio - (projectMUseUpscaler_ ? static_cast<double>(upscaleGpu.p95Ms) : 0.0);
+
+        const float measuredScale = EffectiveProjectMRenderScale();
+        float predictedScale = minAdaptiveScale;
+        if (targetMs > 0.0) {
+            predictedScale = measuredScale *
+                             static_cast<float>(std::sqrt(targetMs / static_cast<double>(projectMGpu.p95Ms)));
+        }
+        predictedScale = std::clamp(predictedScale, minAdaptiveScale, projectMRenderScale_);
+
+        // Scale goes with the square root of time, so a two-sigma swing in time moves the prediction by s * sd / avg.
+        const float relativeNoise = projectMGpu.stddevMs / std::max(projectMGpu.avgMs, 0.01f);
+        const float deadband = std::clamp(measuredScale * relativeNoise, kGpuScaleMinDeadband, 0.10f);
+        const float fromScale = projectMAdaptiveRenderScale_;
+        if (std::fabs(predictedScale - fromScale) < deadband) {
+            return false;
         }
-        if (std::fabs(projectMRenderScale_ - renderScale) > 0.0005f) {
-            projectMRenderScale_ = renderScale;
-            projectMAdaptiveRenderScale_ = projectMRenderScale_;
-            lowFpsForAutoScaleSinceSeconds_ = -1.0;
-            highFpsForAutoScaleSinceSeconds_ = -1.0;
-            renderConfigChanged = true;
+
+        projectMAdaptiveRenderScale_ = predictedScale;
+        if (!ApplyProjectMRenderConfiguration()) {
+            LOGE("Failed to apply GPU-driven render scale.");
+            exitRenderLoop_ = true;
+            return true;
         }
-        if (!perfAutoScaleEnabled_ &&
-            std::fabs(projectMAdaptiveRenderScale_ - projectMRenderScale_) > 0.0005f) {
-            projectMAdaptiveRenderScale_ = projectMRenderScale_;
-            renderConfigChanged = true;
+        const bool scaledDown = predictedScale < fromScale;
+        lowFpsForAutoScaleSinceSeconds_ = -1.0;
+        highFpsForAutoScaleSinceSeconds_ = -1.0;
+        lastAutoScaleAdjustSeconds_ = nowSeconds;
+        // Feedback only; these corrections are frequent enough that popping the HUD would hold SpaceWarp off.
+        SetHudInputFeedback(nowSeconds, scaledDown ? "AUTO SCALE DOWN" : "AUTO SCALE UP");
+        LOGI("GPU render scale %s: %.2f -> %.2f (projectM p95 %.2fms sd %.2fms @ %u px, upscale p95 %.2fms, eye %.2fms, budget %.2fms, cadence %s, target %.2fms, deadband %.3f)",
+             scaledDown ? "down" : "up",
+             static_cast<double>(fromScale),
+             static_cast<double>(EffectiveProjectMRenderScale()),
+             static_cast<double>(projectMGpu.p95Ms),
+             static_cast<double>(projectMGpu.stddevMs),
+             renderPixels,
+             static_cast<double>(upscaleGpu.p95Ms),
+             eyeMs,
+             budgetMs,
+             kProjectMCadenceLabels[static_cast<size_t>(projectMCadenceLevel_)],
+             targetMs,
+             static_cast<double>(deadband));
+        return true;
+    }
+
+    // Unfocused (system menu, guardian) and headset-off frames still reach the compositor, but nobody is looking at
+    // projectM. Audio keeps flowing; only the projectM frame rate drops, so the render state is untouched and the
+    // first focused frame is back at full quality.
+    void UpdateIdleThrottle(double nowSeconds, float deltaSeconds) {
+        IdleThrottle throttle = IdleThrottle::Full;
+        if (xrSessionState_ != XR_SESSION_STATE_FOCUSED) {
+            throttle = idleUnfocusedThrottle_;
+        }
+        if (!userPresent_) {
+            throttle = std::max(throttle, idleAbsentThrottle_);
+        }
+
+        if (throttle != idleThrottle_) {
+            if (idleThrottle_ == IdleThrottle::Full) {
+                const std::array<GpuPassStats, kGpuPassCount> gpuPassStats = SnapshotGpuPassStats();
+                idleThrottleGpuMsPerFrame_ = gpuPassStats[static_cast<size_t>(GpuPass::ProjectM)].avgMs +
+                                             gpuPassStats[static_cast<size_t>(GpuPass::Upscale)].avgMs;
+                idleThrottleCpuMsPerFrame_ = SnapshotProjectMCpuStats().render.avgMs;
+                idleThrottleSinceSeconds_ = nowSeconds;
+                idleSavingsEpisode_ = {};
+                LOGI("Idle throttle: %s (%s) projectM gpu=%.2fms cpu=%.2fms per frame",
+                     IdleThrottleLabel(throttle),
+                     userPresent_ ? "unfocused" : "headset off",
+                     static_cast<double>(idleThrottleGpuMsPerFrame_),
+                     static_cast<double>(idleThrottleCpuMsPerFrame_));
+            } else if (throttle == IdleThrottle::Full) {
+                LOGI("Idle throttle ended after %.1fs: projectM frames avoided=%.0f est. saved gpu=%.0fms cpu=%.0fms",
+                     nowSeconds - idleThrottleSinceSeconds_,
+                     idleSavingsEpisode_.skippedFrames,
+                     idleSavingsEpisode_.gpuMs,
+                     idleSavingsEpisode_.cpuMs);
+                // Throttled frame times measured the runtime's unfocused pacing, not projectM. Restart the FPS
+                // average and hold timers so the levers resume from the state they were left in.
+                smoothedFrameSeconds_ = 0.0;
+                lowFpsSinceSeconds_ = -1.0;
+                lowFpsForAutoScaleSinceSeconds_ = -1.0;
+                highFpsForAutoScaleSinceSeconds_ = -1.0;
+                lastAutoScaleAdjustSeconds_ = nowSeconds;
+                // Request a frame right away even under a reduced cadence.
+                projectMCadenceAccumulator_ = 1.0f;
+            } else {
+                LOGI("Idle throttle: %s -> %s", IdleThrottleLabel(idleThrottle_), IdleThrottleLabel(throttle));
+            }
+            idleThrottle_ = throttle;
         }
-        if (renderConfigChanged && projectM_ != nullptr) {
-            if (!ApplyProjectMRenderConfiguration()) {
-                LOGE("Failed to apply runtime render scaling update.");
-                exitRenderLoop_ = true;
+
+        if (idleThrottle_ != IdleThrottle::Full) {
+            const double seconds = static_cast<double>(deltaSeconds);
+            if (userPresent_) {
+                idleSavingsSinceLog_.unfocusedSeconds += seconds;
+                idleSavingsEpisode_.unfocusedSeconds += seconds;
             } else {
-                SetHudInputFeedback(nowSeconds, projectMUseUpscaler_ ? "SGSR SCALE UPDATED" : "RENDER SCALE UPDATED");
-                ExtendHudVisibility(nowSeconds, kHudVisibleAfterStatusChangeSeconds);
+                idleSavingsSinceLog_.absentSeconds += seconds;
+                idleSavingsEpisode_.absentSeconds += seconds;
             }
         }
+    }
 
-        std::string meshText;
-        int parsedMeshWidth = kDefaultMeshWidth;
-        int parsedMeshHeight = kDefaultMeshHeight;
-        if (ReadSystemProperty("debug.projectm.quest.perf.mesh", meshText) &&
-            ParseIntPairText(meshText, parsedMeshWidth, parsedMeshHeight)) {
-            parsedMeshWidth = std::clamp(parsedMeshWidth, 16, 128);
-            parsedMeshHeight = std::clamp(parsedMeshHeight, 12, 128);
+    // skippedFrames is the fraction of a projectM frame this display frame would have rendered unthrottled.
+    void AddIdleThrottleSavings(float skippedFrames) {
+        if (skippedFrames <= 0.0f) {
+            return;
+        }
+        const double frames = static_cast<double>(skippedFrames);
+        const double gpuMs = frames * static_cast<double>(idleThrottleGpuMsPerFrame_);
+        const double cpuMs = frames * static_cast<double>(idleThrottleCpuMsPerFrame_);
+        for (IdleThrottleSavings* savings : {&idleSavingsSinceLog_, &idleSavingsEpisode_}) {
+            savings->skippedFrames += frames;
+            savings->gpuMs += gpuMs;
+            savings->cpuMs += cpuMs;
+        }
+    }
+
+    void LogIdleThrottleStats() {
+        const IdleThrottleSavings& savings = idleSavingsSinceLog_;
+        if (savings.unfocusedSeconds + savings.absentSeconds <= 0.0) {
+            return;
+        }
+        LOGI("Idle stats: throttle=%s unfocused=%.1fs absent=%.1fs presence=%s projectM frames avoided=%.0f est. saved gpu=%.0fms cpu=%.0fms clocks=%s/%s runtimePerf=%d",
+             IdleThrottleLabel(idleThrottle_),
+             savings.unfocusedSeconds,
+             savings.absentSeconds,
+             userPresenceExtensionEnabled_ ? (userPresent_ ? "present" : "absent") : "n/a",
+             savings.skippedFrames,
+             savings.gpuMs,
+             savings.cpuMs,
+             appliedPerfLevelValid_[0] ? PerfSettingsLevelLabel(appliedPerfLevels_[0]) : "-",
+             appliedPerfLevelValid_[1] ? PerfSettingsLevelLabel(appliedPerfLevels_[1]) : "-",
+             static_cast<int>(runtimePerfNotificationLevel_));
+        idleSavingsSinceLog_ = {};
+    }
+
+    // Shared hysteresis for the stepped levers: FPS has to stay past a threshold for the hold time (a runtime
+    // "impaired" warning skips the hold on the way down), steps are spaced by the cooldown, and each step restarts
+    // both timers. Down moves the first lever in table order that can move; up waits on the last one that can.
+    // Returns true when a lever moved.
+    template <size_t N>
+    bool UpdateSteppedPerfLevers(const std::array<SteppedPerfLever, N>& levers,
+                                 double nowSeconds,
+                                 bool wantDown,
+                                 bool skipDownHold,
+                                 bool wantUp,
+                                 double smoothedFps,
+                                 double downFps,
+                                 double upFps,
+                                 const char* downReason) {
+        const bool cooldownReady = nowSeconds - lastAutoScaleAdjustSeconds_ >= perfAutoScaleCooldownSeconds_;
+        const bool anyDown = std::any_of(levers.begin(), levers.end(), [](const SteppedPerfLever& lever) {
+            return lever.canStepDown;
+        });
+        const bool anyUp = std::any_of(levers.begin(), levers.end(), [](const SteppedPerfLever& lever) {
+            return lever.canStepUp;
+        });
+        const SteppedPerfLever* moved = nullptr;
+        bool movedDown = false;
+        std::string from;
+
+        if (wantDown && anyDown) {
+            highFpsForAutoScaleSinceSeconds_ = -1.0;
+            if (lowFpsForAutoScaleSinceSeconds_ < 0.0) {
+                lowFpsForAutoScaleSinceSeconds_ = nowSeconds;
+            } else if (cooldownReady &&
+                       (skipDownHold || nowSeconds - lowFpsForAutoScaleSinceSeconds_ >= perfAutoScaleHoldSeconds_)) {
+                for (const SteppedPerfLever& lever : levers) {
+                    if (!lever.canStepDown) {
+                        continue;
+                    }
+                    from = lever.describe();
+                    if (lever.stepDown()) {
+                        moved = &lever;
+                        movedDown = true;
+                        break;
+                    }
+                }
+            }
         } else {
-            parsedMeshWidth = kDefaultMeshWidth;
-            parsedMeshHeight = kDefaultMeshHeight;
+            lowFpsForAutoScaleSinceSeconds_ = -1.0;
         }
 
-        if ((meshWidth_ != parsedMeshWidth || meshHeight_ != parsedMeshHeight) && projectM_ != nullptr) {
-            meshWidth_ = parsedMeshWidth;
-            meshHeight_ = parsedMeshHeight;
-            projectm_set_mesh_size(projectM_, meshWidth_, meshHeight_);
-            LOGI("projectM mesh size set to %d x %d", meshWidth_, meshHeight_);
-            hudInputFeedbackLabel_ = "QUALITY MESH UPDATED";
-            hudInputFeedbackUntilSeconds_ = nowSeconds + kHudInputFeedbackSeconds;
-            hudTextDirty_ = true;
-            ExtendHudVisibility(nowSeconds, kHudVisibleAfterStatusChangeSeconds);
+        if (moved == nullptr && wantUp && anyUp) {
+            if (highFpsForAutoScaleSinceSeconds_ < 0.0) {
+                highFpsForAutoScaleSinceSeconds_ = nowSeconds;
+            } else if (cooldownReady) {
+                const double highSeconds = nowSeconds - highFpsForAutoScaleSinceSeconds_;
+                auto lever = std::find_if(levers.rbegin(), levers.rend(), [](const SteppedPerfLever& candidate) {
+                    return candidate.canStepUp;
+                });
+                if (highSeconds >= std::max(perfAutoScaleHoldSeconds_, lever->upHoldSeconds)) {
+                    from = lever->describe();
+                    lever->stepUp();
+                    moved = &*lever;
+                }
+            }
+        } else if (moved == nullptr) {
+            highFpsForAutoScaleSinceSeconds_ = -1.0;
         }
 
-        const bool clearMarkedRequest = readBoolProperty("debug.projectm.quest.perf.clear_marked", false);
-        if (clearMarkedRequest && !clearMarkedLatch_) {
-            ClearSlowPresetMarks();
-            clearMarkedLatch_ = true;
-            hudInputFeedbackLabel_ = "CLEARED SLOW PRESET MARKS";
-            hudInputFeedbackUntilSeconds_ = nowSeconds + kHudInputFeedbackSeconds;
-            hudTextDirty_ = true;
+        if (moved == nullptr) {
+            return false;
+        }
+        if (exitRenderLoop_) {
+            return true;
+        }
+        lowFpsForAutoScaleSinceSeconds_ = -1.0;
+        highFpsForAutoScaleSinceSeconds_ = -1.0;
+        lastAutoScaleAdjustSeconds_ = nowSeconds;
+        SetHudInputFeedback(nowSeconds, movedDown ? moved->downFeedback : moved->upFeedback);
+        if (moved->extendHud) {
             ExtendHudVisibility(nowSeconds, kHudVisibleAfterStatusChangeSeconds);
         }
-        if (!clearMarkedRequest) {
-            clearMarkedLatch_ = false;
+        const std::string to = moved->describe();
+        if (movedDown) {
+            LOGW("%s: %s -> %s (smoothed FPS %.1f, threshold %.1f%s)",
+                 moved->downLog,
+                 from.c_str(),
+                 to.c_str(),
+                 smoothedFps,
+                 downFps,
+                 downReason);
+        } else {
+            LOGI("%s: %s -> %s (smoothed FPS %.1f > %.1f)", moved->upLog, from.c_str(), to.c_str(), smoothedFps, upFps);
         }
-    }
-
-    void SetHudInputFeedback(double nowSeconds, const std::string& feedbackLabel) {
-        hudInputFeedbackLabel_ = feedbackLabel;
-        hudInputFeedbackUntilSeconds_ = nowSeconds + kHudInputFeedbackSeconds;
-        hudTextDirty_ = true;
+        return true;
     }
 
     void UpdatePerformanceAutoSkip(double nowSeconds, float deltaSeconds) {
         if (deltaSeconds <= 0.0f) {
             return;
         }
+        if (UpdateProjectMWatchdog(nowSeconds)) {
+            return;
+        }
 
         const double clampedDelta = std::clamp(static_cast<double>(deltaSeconds), 1.0 / 240.0, 0.5);
         if (smoothedFrameSeconds_ <= 0.0) {
@@ -4297,9 +9065,34 @@ private:
         }
 
         const double smoothedFps = 1.0 / std::max(smoothedFrameSeconds_, 1e-4);
+        const double thresholdScale = static_cast<double>(FpsThresholdScale());
+        const double downFps = static_cast<double>(perfAutoScaleDownFps_) * thresholdScale;
+        const double upFps = static_cast<double>(perfAutoScaleUpFps_) * thresholdScale;
+        const double skipMinFps = static_cast<double>(perfAutoSkipMinFps_) * thresholdScale;
+        // Runtime compositor/thermal warnings count as a low-FPS signal so the ladder steps before frames drop.
+        const bool runtimePerfWarning = runtimePerfNotificationLevel_ >= XR_PERF_SETTINGS_NOTIF_LEVEL_WARNING_EXT;
+        const bool runtimePerfImpaired = runtimePerfNotificationLevel_ >= XR_PERF_SETTINGS_NOTIF_LEVEL_IMPAIRED_EXT;
+        const bool wantQualityDown = smoothedFps < downFps || runtimePerfWarning;
+        const char* downReason = smoothedFps < downFps ? "" : ", runtime perf warning";
         if (nowSeconds - lastRenderStatsLogSeconds_ >= kRenderStatsLogIntervalSeconds) {
             lastRenderStatsLogSeconds_ = nowSeconds;
-            LOGI("Render stats: SGSR=%d targetScale=%.2f adaptiveScale=%.2f render=%d x %d output=%u x %u smoothedFPS=%.1f",
+            const std::array<GpuPassStats, kGpuPassCount> gpuPassStats = SnapshotGpuPassStats();
+            const std::string gpuPassSummary = FormatGpuPassStats(gpuPassStats);
+            char qualityLabel[24] = "off";
+            if (QualityGovernorActive()) {
+                std::snprintf(qualityLabel, sizeof(qualityLabel), "%zu/%zu", qualityRung_ + 1, qualityLadder_.size());
+            }
+            WriteGpuPassStatsDump(gpuPassStats, smoothedFps);
+            uint32_t hudTextUpdates = 0;
+            double hudTextRasterMaxMicros = 0.0;
+            {
+                std::lock_guard<std::mutex> lock(hudTextMutex_);
+                hudTextUpdates = hudTextUpdatesSinceLog_;
+                hudTextRasterMaxMicros = hudTextRasterMaxMicros_;
+                hudTextUpdatesSinceLog_ = 0;
+                hudTextRasterMaxMicros_ = 0.0;
+            }
+            LOGI("Render stats: SGSR=%d targetScale=%.2f adaptiveScale=%.2f render=%d x %d output=%u x %u formats=%s/%s eye=%.2f refresh=%.0fHz cadence=%s quality=%s spaceWarp=%d foveation=%s%s smoothedFPS=%.1f projectM=%s produced=%llu consumed=%llu coalesced=%llu dropped=%llu staleness=%.1f/%.1fms gpu(avg/p50/p95 ms) %s hudText updates=%u raster=%.0fus upload=%.0fus/%.1fKB",
                  projectMUseUpscaler_ ? 1 : 0,
                  projectMRenderScale_,
                  EffectiveProjectMRenderScale(),
@@ -4307,81 +9100,205 @@ private:
                  projectMRenderHeight_,
                  static_cast<unsigned>(projectMOutputWidth_),
                  static_cast<unsigned>(projectMOutputHeight_),
-                 smoothedFps);
+                 projectMUseUpscaler_ ? GetRenderTargetFormatInfo(projectMSourceFormat_).label : "-",
+                 GetRenderTargetFormatInfo(projectMOutputFormat_).label,
+                 eyeBufferAdaptiveScale_,
+                 static_cast<double>(activeDisplayRefreshRate_),
+                 kProjectMCadenceLabels[static_cast<size_t>(projectMCadenceLevel_)],
+                 qualityLabel,
+                 spaceWarpSubmitting_ ? 1 : 0,
+                 foveationReady_ ? FoveationLevelLabel(appliedFoveationLevel_) : "n/a",
+                 foveationReady_ && appliedFoveationDynamic_ ? "+dyn" : "",
+                 smoothedFps,
+                 projectMAsyncRender_ ? "thread" : "inline",
+                 static_cast<unsigned long long>(projectMFramesProduced_.load()),
+                 static_cast<unsigned long long>(projectMFramesConsumed_),
+                 static_cast<unsigned long long>(projectMFrameRequestsCoalesced_),
+                 static_cast<unsigned long long>(projectMFramesDropped_.load()),
+                 projectMStalenessSmoothedSeconds_ * 1000.0,
+                 projectMStalenessMaxSeconds_ * 1000.0,
+                 gpuPassSummary.c_str(),
+                 hudTextUpdates,
+                 hudTextRasterMaxMicros,
+                 hudTextUploadMaxMicros_,
+                 static_cast<double>(hudTextUploadBytesSinceLog_) / 1024.0);
+            hudTextUploadBytesSinceLog_ = 0;
+            hudTextUploadMaxMicros_ = 0.0;
+            projectMStalenessMaxSeconds_ = 0.0;
+            LogCaptureStats();
+            LogIdleThrottleStats();
+            FlushPresetGpuCosts();
+        }
+        if (idleThrottle_ != IdleThrottle::Full) {
+            // Nothing here would measure projectM; hold every lever where it is until focus returns.
+            return;
+        }
+        if (UpdateRenderTargetFormatProbe(nowSeconds)) {
+            return;
         }
 
-        const bool sgsrAvailable = sgsrProgram_ != 0 && sgsrVao_ != 0;
-        if (perfAutoScaleEnabled_ &&
-            sgsrEnabled_ &&
-            sgsrAvailable &&
-            projectMRenderScale_ < 0.999f &&
-            projectM_ != nullptr &&
-            nowSeconds - lastPresetSwitchSeconds_ >= kPerfGraceAfterPresetSwitchSeconds) {
+        const bool upscalerAvailable = sgsrVao_ != 0 && sgsrProgram_ != 0;
+        const bool autoScaleAvailable = perfAutoScaleEnabled_ &&
+                                        sgsrEnabled_ &&
+                                        upscalerAvailable &&
+                                        projectMRenderScale_ < 0.999f &&
+                                        projectM_ != nullptr;
+        const bool governorActive = QualityGovernorActive();
+        const bool autoFoveationAvailable = !governorActive && perfAutoFoveationEnabled_ && foveationReady_;
+        if ((governorActive || perfAutoMeshEnabled_ || autoScaleAvailable || autoFoveationAvailable ||
+             perfAutoEyeScaleEnabled_ || perfAutoCadenceEnabled_ || spaceWarpReady_) &&
+            nowSeconds - lastPresetSwitchSeconds_ >= PerfGraceAfterPresetSwitchSeconds()) {
             const float minAdaptiveScale =
                 std::clamp(std::min(perfAutoScaleMinRenderScale_, projectMRenderScale_),
-                           kMinProjectMRenderScale,
+                           MinProjectMRenderScale(),
                            1.0f);
-            const bool cooldownReady =
-                nowSeconds - lastAutoScaleAdjustSeconds_ >= perfAutoScaleCooldownSeconds_;
-
-            if (smoothedFps < static_cast<double>(perfAutoScaleDownFps_) &&
-                projectMAdaptiveRenderScale_ > minAdaptiveScale + 0.0005f) {
-                highFpsForAutoScaleSinceSeconds_ = -1.0;
-                if (lowFpsForAutoScaleSinceSeconds_ < 0.0) {
-                    lowFpsForAutoScaleSinceSeconds_ = nowSeconds;
-                } else if (cooldownReady &&
-                           nowSeconds - lowFpsForAutoScaleSinceSeconds_ >= perfAutoScaleHoldSeconds_) {
-                    const float nextScale = std::max(minAdaptiveScale, projectMAdaptiveRenderScale_ - perfAutoScaleStep_);
-                    if (std::fabs(nextScale - projectMAdaptiveRenderScale_) > 0.0005f) {
-                        projectMAdaptiveRenderScale_ = nextScale;
-                        if (!ApplyProjectMRenderConfiguration()) {
-                            LOGE("Failed to auto-reduce render scale.");
-                            exitRenderLoop_ = true;
-                            return;
-                        }
-                        lowFpsForAutoScaleSinceSeconds_ = -1.0;
-                        highFpsForAutoScaleSinceSeconds_ = -1.0;
-                        lastAutoScaleAdjustSeconds_ = nowSeconds;
-                        SetHudInputFeedback(nowSeconds, "AUTO SCALE DOWN");
-                        ExtendHudVisibility(nowSeconds, kHudVisibleAfterStatusChangeSeconds);
-                        LOGW("Auto render scale down: %.2f (smoothed FPS %.1f < %.1f)",
-                             EffectiveProjectMRenderScale(),
-                             smoothedFps,
-                             static_cast<double>(perfAutoScaleDownFps_));
-                        return;
-                    }
-                }
-            } else {
-                lowFpsForAutoScaleSinceSeconds_ = -1.0;
+            // The quality governor owns render scale, mesh, foveation and refresh rate. Eye scale, cadence
+            // and SpaceWarp below only engage once it is on its last rung, and must be released before it climbs.
+            const bool extrasEngaged = eyeBufferAdaptiveScale_ < eyeBufferScale_ - 0.0005f ||
+                                       projectMCadenceLevel_ > projectMCadenceBaseLevel_ ||
+                                       spaceWarpEngaged_;
+            // The mesh is a CPU lever inside the rung's mesh cap, settled per preset before the GPU levers move.
+            if (UpdatePresetMeshSize(nowSeconds)) {
+                return;
             }
-
-            if (smoothedFps > static_cast<double>(perfAutoScaleUpFps_) &&
-                projectMAdaptiveRenderScale_ < projectMRenderScale_ - 0.0005f) {
-                if (highFpsForAutoScaleSinceSeconds_ < 0.0) {
-                    highFpsForAutoScaleSinceSeconds_ = nowSeconds;
-                } else if (cooldownReady &&
-                           nowSeconds - highFpsForAutoScaleSinceSeconds_ >= perfAutoScaleHoldSeconds_) {
-                    const float nextScale = std::min(projectMRenderScale_, projectMAdaptiveRenderScale_ + perfAutoScaleStep_);
-                    if (std::fabs(nextScale - projectMAdaptiveRenderScale_) > 0.0005f) {
-                        projectMAdaptiveRenderScale_ = nextScale;
-                        if (!ApplyProjectMRenderConfiguration()) {
-                            LOGE("Failed to auto-increase render scale.");
-                            exitRenderLoop_ = true;
-                            return;
-                        }
-                        highFpsForAutoScaleSinceSeconds_ = -1.0;
-                        lowFpsForAutoScaleSinceSeconds_ = -1.0;
-                        lastAutoScaleAdjustSeconds_ = nowSeconds;
-                        SetHudInputFeedback(nowSeconds, "AUTO SCALE UP");
-                        ExtendHudVisibility(nowSeconds, kHudVisibleAfterStatusChangeSeconds);
-                        LOGI("Auto render scale up: %.2f (smoothed FPS %.1f > %.1f)",
-                             EffectiveProjectMRenderScale(),
-                             smoothedFps,
-                             static_cast<double>(perfAutoScaleUpFps_));
-                    }
-                }
-            } else {
-                highFpsForAutoScaleSinceSeconds_ = -1.0;
+            if (governorActive &&
+                UpdateQualityGovernor(nowSeconds, wantQualityDown, smoothedFps > upFps && !runtimePerfWarning, extrasEngaged)) {
+                return;
+            }
+            const bool governorExhausted = !governorActive || qualityRung_ + 1 >= qualityLadder_.size();
+            // Without the governor, per-pass GPU timers drive the render scale from measured projectM cost; the
+            // FPS-stepped scale below is the fallback when the timers are unavailable.
+            const bool gpuScaleActive = !governorActive && autoScaleAvailable && perfGpuScaleEnabled_ &&
+                                        glGetQueryObjectui64vEXT_ != nullptr;
+            if (gpuScaleActive && UpdateGpuRenderScaleController(nowSeconds, minAdaptiveScale)) {
+                return;
+            }
+            const float scaleDownTo = std::max(minAdaptiveScale, projectMAdaptiveRenderScale_ - perfAutoScaleStep_);
+            const float scaleUpTo = std::min(projectMRenderScale_, projectMAdaptiveRenderScale_ + perfAutoScaleStep_);
+            const bool canScaleDown = autoScaleAvailable && !governorActive && !gpuScaleActive &&
+                                      projectMAdaptiveRenderScale_ > minAdaptiveScale + 0.0005f &&
+                                      std::fabs(scaleDownTo - projectMAdaptiveRenderScale_) > 0.0005f;
+            const bool canScaleUp = autoScaleAvailable && !governorActive && !gpuScaleActive &&
+                                    projectMAdaptiveRenderScale_ < projectMRenderScale_ - 0.0005f &&
+                                    std::fabs(scaleUpTo - projectMAdaptiveRenderScale_) > 0.0005f;
+            const bool canFoveateUp = autoFoveationAvailable &&
+                                      static_cast<int>(EffectiveFoveationLevel()) <
+                                          static_cast<int>(kMaxAutoFoveationLevel);
+            const bool canFoveateDown = autoFoveationAvailable && foveationAutoBoost_ > 0;
+            const bool canSpaceWarpOn = governorExhausted && spaceWarpReady_ && spaceWarpMode_ == SpaceWarpMode::Auto &&
+                                        !spaceWarpEngaged_;
+            const bool canSpaceWarpOff = spaceWarpMode_ == SpaceWarpMode::Auto && spaceWarpEngaged_;
+            const bool canCadenceDown = governorExhausted && perfAutoCadenceEnabled_ &&
+                                        projectM_ != nullptr &&
+                                        projectMCadenceLevel_ < static_cast<int>(kProjectMCadenceRatios.size()) - 1;
+            const bool canCadenceUp = perfAutoCadenceEnabled_ && projectMCadenceLevel_ > projectMCadenceBaseLevel_;
+            const bool canRefreshDown = !governorActive && perfAutoRefreshRateEnabled_ && CanDropDisplayRefreshRate();
+            const bool canRefreshUp = !governorActive && perfAutoRefreshRateEnabled_ && displayRefreshRateReady_ &&
+                                      refreshRateDropSteps_ > 0;
+            const bool canEyeScaleDown = governorExhausted && perfAutoEyeScaleEnabled_ &&
+                                         eyeBufferAdaptiveScale_ > perfEyeBufferMinScale_ + 0.0005f;
+            const bool canEyeScaleUp = perfAutoEyeScaleEnabled_ &&
+                                       eyeBufferAdaptiveScale_ < eyeBufferScale_ - 0.0005f;
+
+            // Cheapest lever first on the way down (foveation, refresh rate, eye-buffer rect, projectM cadence,
+            // projectM resolution, then SpaceWarp); the way back up walks the table in reverse.
+            const std::array<SteppedPerfLever, 6> levers{{
+                {"AUTO FOVEATION UP", "Auto foveation up", "AUTO FOVEATION DOWN", "Auto foveation down",
+                 canFoveateUp, canFoveateDown, 0.0, true,
+                 [this]() { return std::string(FoveationLevelLabel(EffectiveFoveationLevel())); },
+                 [this]() {
+                     ++foveationAutoBoost_;
+                     if (!ApplyFoveationProfileIfNeeded()) {
+                         --foveationAutoBoost_;
+                         return false;
+                     }
+                     return true;
+                 },
+                 [this]() {
+                     --foveationAutoBoost_;
+                     ApplyFoveationProfileIfNeeded();
+                 }},
+                // At a lower rate the frame loop is paced by the display, so FPS can't show spare headroom;
+                // probe the higher rate only after a long stable stretch.
+                {"AUTO REFRESH RATE DOWN", "Auto refresh rate down", "AUTO REFRESH RATE UP", "Auto refresh rate up",
+                 canRefreshDown, canRefreshUp, kRefreshRateRaiseHoldSeconds, true,
+                 [this]() { return FormatPerfLeverValue("%.0f Hz", TargetDisplayRefreshRate()); },
+                 [this]() {
+                     ++refreshRateDropSteps_;
+                     ApplyDisplayRefreshRateIfNeeded();
+                     return true;
+                 },
+                 [this]() {
+                     --refreshRateDropSteps_;
+                     ApplyDisplayRefreshRateIfNeeded();
+                 }},
+                {"AUTO EYE SCALE DOWN", "Auto eye buffer scale down", "AUTO EYE SCALE UP", "Auto eye buffer scale up",
+                 canEyeScaleDown, canEyeScaleUp, 0.0, true,
+                 [this]() { return FormatPerfLeverValue("%.2f", eyeBufferAdaptiveScale_); },
+                 [this]() {
+                     eyeBufferAdaptiveScale_ =
+                         std::max(perfEyeBufferMinScale_, eyeBufferAdaptiveScale_ - kEyeBufferScaleStep);
+                     return true;
+                 },
+                 [this]() {
+                     eyeBufferAdaptiveScale_ = std::min(eyeBufferScale_, eyeBufferAdaptiveScale_ + kEyeBufferScaleStep);
+                 }},
+                // Reduced cadence keeps display FPS high by design, so only probe full cadence after a longer
+                // stable stretch; a heavy preset steps straight back down.
+                {"AUTO PROJECTM CADENCE DOWN", "Auto projectM cadence down", "AUTO PROJECTM CADENCE UP",
+                 "Auto projectM cadence up", canCadenceDown, canCadenceUp, kCadenceRaiseHoldSeconds, true,
+                 [this]() {
+                     return std::string(kProjectMCadenceLabels[static_cast<size_t>(projectMCadenceLevel_)]);
+                 },
+                 [this]() {
+                     SetProjectMCadenceLevel(projectMCadenceLevel_ + 1);
+                     RememberPresetCadenceLevel();
+                     return true;
+                 },
+                 [this]() {
+                     SetProjectMCadenceLevel(projectMCadenceLevel_ - 1);
+                     RememberPresetCadenceLevel();
+                 }},
+                {"AUTO SCALE DOWN", "Auto render scale down", "AUTO SCALE UP", "Auto render scale up",
+                 canScaleDown, canScaleUp, 0.0, true,
+                 [this]() { return FormatPerfLeverValue("%.2f", EffectiveProjectMRenderScale()); },
+                 [this, scaleDownTo]() {
+                     projectMAdaptiveRenderScale_ = scaleDownTo;
+                     if (!ApplyProjectMRenderConfiguration()) {
+                         LOGE("Failed to auto-reduce render scale.");
+                         exitRenderLoop_ = true;
+                     }
+                     return true;
+                 },
+                 [this, scaleUpTo]() {
+                     projectMAdaptiveRenderScale_ = scaleUpTo;
+                     if (!ApplyProjectMRenderConfiguration()) {
+                         LOGE("Failed to auto-increase render scale.");
+                         exitRenderLoop_ = true;
+                     }
+                 }},
+                // Half-rate frames are display-paced, so FPS can't show headroom; leave SpaceWarp only after a
+                // long stable stretch and let the ladder re-engage it if the preset is still too heavy. No HUD
+                // extension: a visible HUD holds SpaceWarp off.
+                {"AUTO SPACEWARP ON", "Auto SpaceWarp on", "AUTO SPACEWARP OFF", "Auto SpaceWarp off",
+                 canSpaceWarpOn, canSpaceWarpOff, kSpaceWarpExitHoldSeconds, false,
+                 [this]() { return std::string(spaceWarpEngaged_ ? "on" : "off"); },
+                 [this]() {
+                     spaceWarpEngaged_ = true;
+                     return true;
+                 },
+                 [this]() { spaceWarpEngaged_ = false; }},
+            }};
+            if (UpdateSteppedPerfLevers(levers,
+                                        nowSeconds,
+                                        wantQualityDown,
+                                        runtimePerfImpaired,
+                                        smoothedFps > upFps && !runtimePerfWarning,
+                                        smoothedFps,
+                                        downFps,
+                                        upFps,
+                                        downReason)) {
+                return;
             }
         } else {
             lowFpsForAutoScaleSinceSeconds_ = -1.0;
@@ -4390,7 +9307,10 @@ private:
 
         MaybeReleaseOneSlowPresetForRetry(nowSeconds);
 
-        if (!perfAutoSkipEnabled_ || lockCurrentPreset_ || presetFiles_.size() <= 1 || usingFallbackPreset_) {
+        // Skipping is the last resort: the governor has to be out of rungs first.
+        const bool governorHasRungsLeft = governorActive && qualityRung_ + 1 < qualityLadder_.size();
+        if (!perfAutoSkipEnabled_ || lockCurrentPreset_ || presetFiles_.size() <= 1 || usingFallbackPreset_ ||
+            governorHasRungsLeft) {
             lowFpsSinceSeconds_ = -1.0;
             return;
         }
@@ -4416,12 +9336,12 @@ private:
                                                     perfAutoSkipHoldSeconds_ * perfRepeatSlowSkipHoldScale_);
         }
 
-        if (nowSeconds - lastPresetSwitchSeconds_ < kPerfGraceAfterPresetSwitchSeconds ||
+        if (nowSeconds - lastPresetSwitchSeconds_ < PerfGraceAfterPresetSwitchSeconds() ||
             nowSeconds - lastAutoSkipSeconds_ < perfAutoSkipCooldownSeconds_) {
             lowFpsSinceSeconds_ = -1.0;
             return;
         }
-        if (smoothedFps >= static_cast<double>(perfAutoSkipMinFps_)) {
+        if (smoothedFps >= skipMinFps) {
             lowFpsSinceSeconds_ = -1.0;
             return;
         }
@@ -4446,7 +9366,7 @@ private:
         LOGW("Auto-skipped slow preset %s (smoothed FPS %.1f < %.1f hold %.2fs repeats=%d)",
              slowPresetLabel.c_str(),
              smoothedFps,
-             static_cast<double>(perfAutoSkipMinFps_),
+             skipMinFps,
              effectiveAutoSkipHoldSeconds,
              priorSlowFailures);
     }
@@ -4541,7 +9461,6 @@ private:
                     ? ProjectionMode::FrontDome
                     : ProjectionMode::FullSphere;
                 hudFlashRt_ = kHudFlashPeak;
-                hudTextDirty_ = true;
                 SetHudInputFeedback(nowSeconds,
                                     projectionMode_ == ProjectionMode::FrontDome
                                         ? "RT PROJECTION DOME"
@@ -4579,7 +9498,6 @@ private:
         if (currentAudioMode_ != g_audioMode ||
             currentMediaPlaying_ != g_mediaPlaying ||
             currentMediaLabel_ != mediaLabel) {
-            hudTextDirty_ = true;
             ExtendHudVisibility(nowSeconds, kHudVisibleAfterStatusChangeSeconds);
         }
         currentAudioMode_ = g_audioMode;
@@ -4601,7 +9519,37 @@ private:
         decayValue(hudFlashMenu_);
     }
 
-    void RenderHud(const glm::mat4& projection, const glm::mat4& view, const XrPosef& pose, double nowSeconds) {
+    // The chrome only depends on the layout constants, so this runs once after init; the button labels for
+    // the utility panel live in the text texture.
+    void RefreshHudChromeTextureIfNeeded() {
+        if (!hudChromeDirty_ || hudChromeProgram_ == 0 || hudChromeFramebuffer_ == 0) {
+            return;
+        }
+        hudChromeDirty_ = false;
+
+        GLint previousFramebuffer = 0;
+        std::array<GLint, 4> previousViewport{};
+        glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previousFramebuffer);
+        glGetIntegerv(GL_VIEWPORT, previousViewport.data());
+
+        glBindFramebuffer(GL_FRAMEBUFFER, hudChromeFramebuffer_);
+        glViewport(0, 0, kHudChromeTextureWidth, kHudChromeTextureHeight);
+        glDisable(GL_BLEND);
+        glUseProgram(hudChromeProgram_);
+        glBindVertexArray(hudVao_);
+        glDrawArrays(GL_TRIANGLES, 0, 6);
+        glBindVertexArray(0);
+
+        glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(previousFramebuffer));
+        glViewport(previousViewport[0], previousViewport[1], previousViewport[2], previousViewport[3]);
+        LOGI("HUD chrome baked at %d x %d.", kHudChromeTextureWidth, kHudChromeTextureHeight);
+    }
+
+    void RenderHud(const glm::mat4& projection,
+                   const glm::mat4& view,
+                   const XrPosef& pose,
+                   double nowSeconds,
+                   bool timePass) {
         if (hudProgram_ == 0 || hudVao_ == 0) {
             return;
         }
@@ -4621,20 +9569,29 @@ private:
         model = glm::scale(model, glm::vec3(hudWidth_, hudHeight_, 1.0f));
         const glm::mat4 mvp = projection * view * model;
 
+        RefreshHudChromeTextureIfNeeded();
+        if (timePass) {
+            BeginGpuPassTimer(hudPassTimer_);
+        }
+
         glEnable(GL_BLEND);
         glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
         glDisable(GL_DEPTH_TEST);
 
         glUseProgram(hudProgram_);
-        RefreshHudTextTextureIfNeeded(nowSeconds);
         glUniformMatrix4fv(hudMvpLoc_, 1, GL_FALSE, glm::value_ptr(mvp));
-        glUniform4f(hudFlashALoc_, hudFlashA_, 0.0f, 0.0f, 0.0f);
-        glUniform4f(hudFlashBLoc_, hudFlashB_, 0.0f, 0.0f, 0.0f);
-        glUniform4f(hudFlashXLoc_, hudFlashX_, 0.0f, 0.0f, 0.0f);
-        glUniform4f(hudFlashYLoc_, hudFlashY_, 0.0f, 0.0f, 0.0f);
-        glUniform4f(hudFlashRtLoc_, hudFlashRt_, 0.0f, 0.0f, 0.0f);
-        glUniform4f(hudFlashLtLoc_, hudFlashLt_, 0.0f, 0.0f, 0.0f);
-        glUniform4f(hudFlashMenuLoc_, hudFlashMenu_, 0.0f, 0.0f, 0.0f);
+        const std::array<float, kHudChromeButtons.size()> flashes{
+            hudFlashX_, hudFlashA_, hudFlashY_, hudFlashB_, hudFlashLt_, hudFlashMenu_, hudFlashRt_,
+        };
+        std::array<float, kHudChromeButtons.size()> flashGains{};
+        bool anyFlash = false;
+        for (size_t i = 0; i < flashes.size(); ++i) {
+            // Raising the blend alpha from base to base + flash scales the button's offset from the panel.
+            flashGains[i] = flashes[i] / kHudChromeButtons[i].baseAlpha;
+            anyFlash = anyFlash || flashes[i] > 0.0f;
+        }
+        glUniform1fv(hudButtonFlashLoc_, static_cast<GLsizei>(flashGains.size()), flashGains.data());
+        glUniform1f(hudFlashActiveLoc_, anyFlash ? 1.0f : 0.0f);
         const bool leftTouchMode = hudPointerLeftMode_ == HudPointerMode::Touch;
         const bool rightTouchMode = hudPointerRightMode_ == HudPointerMode::Touch;
         const float leftPointerState = !hudPointerLeftVisible_
@@ -4656,26 +9613,30 @@ private:
         glActiveTexture(GL_TEXTURE1);
         glBindTexture(GL_TEXTURE_2D, hudTextTexture_);
         glUniform1i(hudTextSamplerLoc_, 1);
+        glActiveTexture(GL_TEXTURE2);
+        glBindTexture(GL_TEXTURE_2D, hudChromeTexture_);
+        glUniform1i(hudChromeSamplerLoc_, 2);
         glActiveTexture(GL_TEXTURE0);
 
         glBindVertexArray(hudVao_);
         glDrawArrays(GL_TRIANGLES, 0, 6);
         glBindVertexArray(0);
+        if (timePass) {
+            EndGpuPassTimer(hudPassTimer_);
+        }
+        glActiveTexture(GL_TEXTURE2);
+        glBindTexture(GL_TEXTURE_2D, 0);
         glActiveTexture(GL_TEXTURE1);
         glBindTexture(GL_TEXTURE_2D, 0);
         glActiveTexture(GL_TEXTURE0);
     }
 
     void RenderProjectMFrame(double nowSeconds, float deltaSeconds) {
-        if (!projectM_ || projectMFbo_ == 0 || projectMTexture_ == 0) {
+        if (!projectM_) {
             return;
         }
 
         AddAudioForFrame(nowSeconds, deltaSeconds);
-        if (deltaSeconds > 0.0001f) {
-            projectm_set_fps(projectM_, static_cast<int32_t>(1.0f / deltaSeconds));
-        }
-
         RefreshPresetListIfNeeded(nowSeconds);
 
         const bool favoritesOnly = favoritesOnlyMode_ && HasAnyFavoritedPresetsInLibrary();
@@ -4684,23 +9645,49 @@ private:
             selectablePresetCount = GetSelectablePresetCountCached(false, favoritesOnly);
         }
 
+        if (idleThrottle_ == IdleThrottle::Frozen) {
+            // A frozen frame holds its preset too, so the auto-advance timer pauses rather than firing on return.
+            lastPresetSwitchSeconds_ += static_cast<double>(std::max(deltaSeconds, 0.0f));
+        }
         if (!lockCurrentPreset_ &&
             selectablePresetCount > 1 &&
             nowSeconds - lastPresetSwitchSeconds_ > kPresetSwitchSeconds) {
             SwitchPresetRelative(+1, true);
         }
 
-        glBindFramebuffer(GL_FRAMEBUFFER, projectMFbo_);
-        glViewport(0, 0,
-                   static_cast<GLsizei>(projectMRenderWidth_),
-                   static_cast<GLsizei>(projectMRenderHeight_));
-        glDisable(GL_BLEND);
-        projectm_opengl_render_frame_fbo(projectM_, projectMFbo_);
-        if (projectMUseUpscaler_) {
-            RenderSgsrUpscalePass();
+        float cadenceRatio = kProjectMCadenceRatios[static_cast<size_t>(projectMCadenceLevel_)];
+        if (idleThrottle_ != IdleThrottle::Full) {
+            const float idleRatio =
+                idleThrottle_ == IdleThrottle::Frozen ? 0.0f : std::min(idleThrottleRate_, cadenceRatio);
+            AddIdleThrottleSavings(cadenceRatio - idleRatio);
+            cadenceRatio = idleRatio;
+        }
+        const bool reducedCadence = cadenceRatio < 0.999f;
+        bool requestFrame = true;
+        if (reducedCadence) {
+            projectMCadenceAccumulator_ += cadenceRatio;
+            if (projectMCadenceAccumulator_ < 1.0f - 1e-4f) {
+                requestFrame = false;
+            } else {
+                projectMCadenceAccumulator_ -= 1.0f;
+            }
+        } else {
+            projectMCadenceAccumulator_ = 0.0f;
+        }
+
+        if (requestFrame) {
+            RequestProjectMFrame(nowSeconds);
+        }
+        if (ConsumeNewestProjectMFrame(nowSeconds, reducedCadence)) {
+            displayFramesSinceProjectMFrame_ = 0;
         } else {
-            glBindFramebuffer(GL_FRAMEBUFFER, 0);
+            ++displayFramesSinceProjectMFrame_;
         }
+        projectMFrameBlend_ =
+            projectMPreviousTexture_ != 0 && cadenceRatio > 0.0f
+                ? std::min(1.0f, static_cast<float>(displayFramesSinceProjectMFrame_ + 1) * cadenceRatio)
+                : 1.0f;
+        UpdateSnapshotCrossfade(nowSeconds);
     }
 
     void PollOpenXrEvents() {
@@ -4723,6 +9710,31 @@ private:
                     break;
                 }
 
+                case XR_TYPE_EVENT_DATA_PERF_SETTINGS_EXT: {
+                    const auto* perfSettings = reinterpret_cast<XrEventDataPerfSettingsEXT*>(&eventData);
+                    HandlePerfSettingsNotification(perfSettings->domain,
+                                                   perfSettings->subDomain,
+                                                   perfSettings->fromLevel,
+                                                   perfSettings->toLevel);
+                    break;
+                }
+
+                case XR_TYPE_EVENT_DATA_DISPLAY_REFRESH_RATE_CHANGED_FB: {
+                    const auto* rateChanged = reinterpret_cast<XrEventDataDisplayRefreshRateChangedFB*>(&eventData);
+                    HandleDisplayRefreshRateChanged(rateChanged->fromDisplayRefreshRate,
+                                                    rateChanged->toDisplayRefreshRate);
+                    break;
+                }
+
+#ifdef XR_EXT_user_presence
+                case XR_TYPE_EVENT_DATA_USER_PRESENCE_CHANGED_EXT: {
+                    const auto* presenceChanged = reinterpret_cast<XrEventDataUserPresenceChangedEXT*>(&eventData);
+                    userPresent_ = presenceChanged->isUserPresent == XR_TRUE;
+                    LOGI("User presence changed: %s", userPresent_ ? "present" : "absent");
+                    break;
+                }
+#endif
+
                 default:
                     break;
             }
@@ -4731,6 +9743,19 @@ private:
         }
     }
 
+    void HandleDisplayRefreshRateChanged(float fromRate, float toRate) {
+        if (toRate <= 1.0f) {
+            return;
+        }
+        activeDisplayRefreshRate_ = toRate;
+        // Thresholds just moved; restart the hold timers so the old rate's samples don't trigger a step.
+        lowFpsForAutoScaleSinceSeconds_ = -1.0;
+        highFpsForAutoScaleSinceSeconds_ = -1.0;
+        lowFpsSinceSeconds_ = -1.0;
+        lastAutoScaleAdjustSeconds_ = ElapsedSeconds();
+        LOGI("Display refresh rate changed: %.0f -> %.0f Hz", static_cast<double>(fromRate), static_cast<double>(toRate));
+    }
+
     void HandleSessionStateChanged() {
         switch (xrSessionState_) {
             case XR_SESSION_STATE_READY: {
@@ -4742,17 +9767,18 @@ private:
                     lastPresetSwitchSeconds_ = lastFrameSeconds_;
                     lowFpsSinceSeconds_ = -1.0;
                     lastAutoSkipSeconds_ = -1000.0;
-                    smoothedFrameSeconds_ = 1.0 / 72.0;
+                    smoothedFrameSeconds_ = 1.0 / std::max(static_cast<double>(activeDisplayRefreshRate_), 1.0);
                     lowFpsForAutoScaleSinceSeconds_ = -1.0;
                     highFpsForAutoScaleSinceSeconds_ = -1.0;
                     lastAutoScaleAdjustSeconds_ = -1000.0;
+                    spaceWarpEngaged_ = false;
+                    spaceWarpSubmitting_ = false;
                     lastRenderStatsLogSeconds_ = -1000.0;
                     lastRuntimePropertyPollSeconds_ = -1000.0;
                     rightTriggerPressed_ = false;
                     leftTriggerPressed_ = false;
                     ResetHudPointerAndTouchState();
                     hudUtilityPanelOpen_ = false;
-                    hudTextDirty_ = true;
                     hudHandTrackingActive_ = false;
                     ResetHandModeDebounce();
                     ClearHandJointRenderState();
@@ -4773,10 +9799,10 @@ private:
                     leftTriggerPressed_ = false;
                     ResetHudPointerAndTouchState();
                     hudUtilityPanelOpen_ = false;
-                    hudTextDirty_ = true;
                     hudHandTrackingActive_ = false;
                     ResetHandModeDebounce();
                     ClearHandJointRenderState();
+                    FlushPresetGpuCosts();
                     LOGI("XR session stopped.");
                 }
                 break;
@@ -4808,10 +9834,16 @@ private:
         }
 
         std::vector<XrCompositionLayerProjectionView> projectionViews;
+        std::vector<XrCompositionLayerSpaceWarpInfoFB> spaceWarpInfos;
         XrCompositionLayerProjection projectionLayer{XR_TYPE_COMPOSITION_LAYER_PROJECTION};
         std::array<XrCompositionLayerBaseHeader*, 1> layers{};
 
-        if (frameState.shouldRender && resumed_ && hasWindow_) {
+        const bool activelyRendering = frameState.shouldRender && resumed_ && hasWindow_;
+        UpdatePerformanceHints(ElapsedSeconds(),
+                               !activelyRendering || xrSessionState_ != XR_SESSION_STATE_FOCUSED ||
+                                   idleThrottle_ != IdleThrottle::Full);
+
+        if (activelyRendering) {
             const double nowSeconds = ElapsedSeconds();
             const float deltaSeconds = static_cast<float>(nowSeconds - lastFrameSeconds_);
             lastFrameSeconds_ = nowSeconds;
@@ -4819,8 +9851,10 @@ private:
             PollRuntimeDebugProperties(nowSeconds);
             UpdateUiStateFromJava(nowSeconds);
             AdvanceHudFlash(std::max(deltaSeconds, 0.0f));
+            UpdateIdleThrottle(nowSeconds, std::max(deltaSeconds, 0.0f));
             UpdatePerformanceAutoSkip(nowSeconds, std::max(deltaSeconds, 0.0f));
             RenderProjectMFrame(nowSeconds, deltaSeconds);
+            UpdateFrameCapture(nowSeconds);
 
             XrViewLocateInfo locateInfo{XR_TYPE_VIEW_LOCATE_INFO};
             locateInfo.viewConfigurationType = XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO;
@@ -4839,7 +9873,9 @@ private:
                 if (viewCountOutput > 0) {
                     centerHeadPose = BuildCenterHeadPose(viewCountOutput);
                     UpdateHandJointRenderState(frameState.predictedDisplayTime);
+                    BuildHandJointGeometry();
                     PollInputActions(nowSeconds, frameState.predictedDisplayTime, centerHeadPose);
+                    UpdateHudText(nowSeconds);
                 } else {
                     hudHandTrackingActive_ = false;
                     ResetHudPointerAndTouchState();
@@ -4848,6 +9884,10 @@ private:
                 }
                 projectionViews.clear();
                 projectionViews.reserve(viewCountOutput);
+                const bool submitSpaceWarp = ShouldSubmitSpaceWarp(nowSeconds) &&
+                                             viewCountOutput <= motionVectorSwapchains_.size();
+                spaceWarpInfos.assign(viewCountOutput, XrCompositionLayerSpaceWarpInfoFB{});
+                bool spaceWarpSubmitted = submitSpaceWarp;
 
                 for (uint32_t viewIndex = 0; viewIndex < viewCountOutput; ++viewIndex) {
                     const auto& swapchain = swapchains_[viewIndex];
@@ -4874,13 +9914,22 @@ private:
                         break;
                     }
 
+                    // Eye, HUD and hand passes are timed on the first view only; the second eye costs the same.
+                    const bool timeEyePasses = viewIndex == 0;
                     const GLuint colorTexture = swapchain.images[imageIndex].image;
                     glBindFramebuffer(GL_FRAMEBUFFER, swapchainFramebuffer_);
                     glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
                                            colorTexture, 0);
-                    glViewport(0, 0, swapchain.width, swapchain.height);
+                    const XrRect2Di eyeRect = EyeBufferRect(swapchain);
+                    glViewport(eyeRect.offset.x, eyeRect.offset.y, eyeRect.extent.width, eyeRect.extent.height);
+                    if (timeEyePasses) {
+                        BeginGpuPassTimer(eyePassTimer_);
+                    }
+                    glEnable(GL_SCISSOR_TEST);
+                    glScissor(eyeRect.offset.x, eyeRect.offset.y, eyeRect.extent.width, eyeRect.extent.height);
                     glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
                     glClear(GL_COLOR_BUFFER_BIT);
+                    glDisable(GL_SCISSOR_TEST);
 
                     const glm::mat4 projection = BuildProjectionMatrix(xrViews_[viewIndex].fov, kNearZ, kFarZ);
                     const glm::mat4 view = BuildViewMatrix(xrViews_[viewIndex].pose);
@@ -4891,15 +9940,47 @@ private:
                     glUniform1i(uTextureLoc_, 0);
                     glUniform1i(uProjectionModeLoc_,
                                 projectionMode_ == ProjectionMode::FrontDome ? 1 : 0);
+                    glUniform1i(uCanvasMappingLoc_, static_cast<GLint>(projectMCanvasMapping_));
+
+                    const bool blendProjectMFrames = projectMFrameBlend_ < 0.999f && projectMPreviousTexture_ != 0;
+                    glUniform1i(uPreviousTextureLoc_, 1);
+                    glUniform1f(uFrameBlendLoc_, blendProjectMFrames ? projectMFrameBlend_ : 1.0f);
+                    if (blendProjectMFrames) {
+                        glActiveTexture(GL_TEXTURE1);
+                        glBindTexture(GL_TEXTURE_2D, projectMPreviousTexture_);
+                    }
+                    // The snapshot has its own unit, so cadence interpolation keeps running under a crossfade.
+                    const bool snapshotCrossfade = projectMSnapshotFade_ < 0.999f && projectMSnapshotTexture_ != 0;
+                    glUniform1i(uSnapshotTextureLoc_, 2);
+                    glUniform1f(uSnapshotFadeLoc_, snapshotCrossfade ? projectMSnapshotFade_ : 1.0f);
+                    if (snapshotCrossfade) {
+                        glActiveTexture(GL_TEXTURE2);
+                        glBindTexture(GL_TEXTURE_2D, projectMSnapshotTexture_);
+                    }
 
                     glActiveTexture(GL_TEXTURE0);
                     glBindTexture(GL_TEXTURE_2D, projectMTexture_);
                     glBindVertexArray(sphereVao_);
                     glDrawElements(GL_TRIANGLES, sphereIndexCount_, GL_UNSIGNED_INT, nullptr);
                     glBindVertexArray(0);
+                    if (blendProjectMFrames) {
+                        glActiveTexture(GL_TEXTURE1);
+                        glBindTexture(GL_TEXTURE_2D, 0);
+                    }
+                    if (snapshotCrossfade) {
+                        glActiveTexture(GL_TEXTURE2);
+                        glBindTexture(GL_TEXTURE_2D, 0);
+                    }
+                    glActiveTexture(GL_TEXTURE0);
+                    if (timeEyePasses) {
+                        EndGpuPassTimer(eyePassTimer_);
+                    }
 
-                    RenderHud(projection, view, centerHeadPose, nowSeconds);
-                    RenderHandJoints(viewProjection);
+                    RenderHud(projection, view, centerHeadPose, nowSeconds, timeEyePasses);
+                    RenderHandJoints(viewProjection, timeEyePasses);
+                    if (viewIndex == 0) {
+                        CaptureEyeBufferIfDue(eyeRect);
+                    }
                     glBindFramebuffer(GL_FRAMEBUFFER, 0);
 
                     XrSwapchainImageReleaseInfo releaseInfo{XR_TYPE_SWAPCHAIN_IMAGE_RELEASE_INFO};
@@ -4910,11 +9991,22 @@ private:
                     layerView.pose = xrViews_[viewIndex].pose;
                     layerView.fov = xrViews_[viewIndex].fov;
                     layerView.subImage.swapchain = swapchain.handle;
-                    layerView.subImage.imageRect.offset = {0, 0};
-                    layerView.subImage.imageRect.extent = {swapchain.width, swapchain.height};
+                    layerView.subImage.imageRect = eyeRect;
                     layerView.subImage.imageArrayIndex = 0;
+                    if (submitSpaceWarp) {
+                        if (RenderSpaceWarpBuffers(viewIndex, spaceWarpInfos[viewIndex])) {
+                            layerView.next = &spaceWarpInfos[viewIndex];
+                        } else {
+                            spaceWarpSubmitted = false;
+                        }
+                    }
                     projectionViews.push_back(layerView);
                 }
+                SetSpaceWarpSubmitting(nowSeconds, spaceWarpSubmitted && !projectionViews.empty());
+                PublishGpuPassStats({{GpuPass::Eye, &eyePassTimer_},
+                                     {GpuPass::Hud, &hudPassTimer_},
+                                     {GpuPass::Hands, &handsPassTimer_}},
+                                    eyeGpuStatsPublishSeconds_);
 
                 if (!projectionViews.empty()) {
                     projectionLayer.space = xrAppSpace_;
@@ -4937,6 +10029,16 @@ private:
         if (XR_FAILED(xrEndFrame(xrSession_, &endInfo))) {
             LOGE("xrEndFrame failed.");
             exitRenderLoop_ = true;
+        } else if (!firstFrameLogged_ && endInfo.layerCount > 0) {
+            // Compare launches with debug.projectm.quest.perf.program_cache=0 and 1 to see what the cache saves.
+            firstFrameLogged_ = true;
+            LOGI("Time to first frame %.0fms (initialize %.0fms, programs %.1fms: cache %s, %u hits, %u misses)",
+                 ElapsedSeconds() * 1000.0,
+                 initializedSeconds_ * 1000.0,
+                 static_cast<double>(programBuildMicros_.load()) / 1000.0,
+                 programCacheDirectory_.empty() ? "off" : "on",
+                 programCacheHits_.load(),
+                 programCacheMisses_.load());
         }
     }
 
@@ -4946,13 +10048,38 @@ private:
         return elapsed.count();
     }
 
-    void Shutdown() {
-        if (projectM_) {
-            projectm_destroy(projectM_);
-            projectM_ = nullptr;
+    void DestroySgsrUpscaler() {
+        if (sgsrVbo_ != 0) {
+            glDeleteBuffers(1, &sgsrVbo_);
+            sgsrVbo_ = 0;
+        }
+        if (sgsrVao_ != 0) {
+            glDeleteVertexArrays(1, &sgsrVao_);
+            sgsrVao_ = 0;
+        }
+        if (sgsrProgram_ != 0) {
+            glDeleteProgram(sgsrProgram_);
+            sgsrProgram_ = 0;
         }
+    }
 
-        DestroyProjectMRenderTargets();
+    void Shutdown() {
+        FlushPresetGpuCosts();
+        StopFileWriteThread();
+        RunProjectMJobAndWait([this]() {
+            if (projectM_) {
+                projectm_destroy(projectM_);
+                projectM_ = nullptr;
+            }
+            ResetProjectMWatchdog();
+            DestroyProjectMRenderTargets();
+            DestroySgsrUpscaler();
+            DestroyGpuPassTimers({&projectMPassTimer_, &upscalePassTimer_});
+            return true;
+        });
+        StopProjectMRenderThread();
+        projectMTexture_ = 0;
+        projectMPreviousTexture_ = 0;
 
         if (sphereIbo_ != 0) {
             glDeleteBuffers(1, &sphereIbo_);
@@ -4986,7 +10113,38 @@ private:
             glDeleteTextures(1, &hudTextTexture_);
             hudTextTexture_ = 0;
         }
+        DestroyGpuPassTimers({&eyePassTimer_, &hudPassTimer_, &handsPassTimer_});
+        if (hudChromeProgram_ != 0) {
+            glDeleteProgram(hudChromeProgram_);
+            hudChromeProgram_ = 0;
+        }
+        if (hudChromeFramebuffer_ != 0) {
+            glDeleteFramebuffers(1, &hudChromeFramebuffer_);
+            hudChromeFramebuffer_ = 0;
+        }
+        if (hudChromeTexture_ != 0) {
+            glDeleteTextures(1, &hudChromeTexture_);
+            hudChromeTexture_ = 0;
+        }
+        StopHudTextThread();
+        for (HudTextPbo& pbo : hudTextPbos_) {
+            if (pbo.mapped != nullptr) {
+                glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo.buffer);
+                glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+                glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            }
+            if (pbo.fence != nullptr) {
+                glDeleteSync(pbo.fence);
+            }
+            if (pbo.buffer != 0) {
+                glDeleteBuffers(1, &pbo.buffer);
+            }
+            pbo = HudTextPbo{};
+        }
+        hudTextWorkerUpload_.rects.clear();
+        hudTextWorkerUpload_.pixels.clear();
         hudTextPixels_.clear();
+        hudTextLabels_ = {};
         if (handVbo_ != 0) {
             glDeleteBuffers(1, &handVbo_);
             handVbo_ = 0;
@@ -4999,23 +10157,18 @@ private:
             glDeleteProgram(handProgram_);
             handProgram_ = 0;
         }
-        if (sgsrVbo_ != 0) {
-            glDeleteBuffers(1, &sgsrVbo_);
-            sgsrVbo_ = 0;
-        }
-        if (sgsrVao_ != 0) {
-            glDeleteVertexArrays(1, &sgsrVao_);
-            sgsrVao_ = 0;
-        }
-        if (sgsrProgram_ != 0) {
-            glDeleteProgram(sgsrProgram_);
-            sgsrProgram_ = 0;
-        }
-
         if (swapchainFramebuffer_ != 0) {
             glDeleteFramebuffers(1, &swapchainFramebuffer_);
             swapchainFramebuffer_ = 0;
         }
+        DestroyFrameCapture();
+        DestroyProjectMSnapshot();
+        if (projectMSnapshotReadFramebuffer_ != 0) {
+            glDeleteFramebuffers(1, &projectMSnapshotReadFramebuffer_);
+            projectMSnapshotReadFramebuffer_ = 0;
+        }
+
+        DestroySpaceWarpResources();
 
         for (auto& swapchain : swapchains_) {
             if (swapchain.handle != XR_NULL_HANDLE) {
@@ -5137,6 +10290,55 @@ private:
     PFN_xrCreateHandTrackerEXT xrCreateHandTrackerEXT_{nullptr};
     PFN_xrDestroyHandTrackerEXT xrDestroyHandTrackerEXT_{nullptr};
     PFN_xrLocateHandJointsEXT xrLocateHandJointsEXT_{nullptr};
+    bool performanceSettingsExtensionEnabled_{false};
+    bool performanceSettingsReady_{false};
+    PFN_xrPerfSettingsSetPerformanceLevelEXT xrPerfSettingsSetPerformanceLevelEXT_{nullptr};
+    std::array<XrPerfSettingsLevelEXT, 2> appliedPerfLevels_{};
+    std::array<bool, 2> appliedPerfLevelValid_{};
+    std::array<std::array<XrPerfSettingsNotificationLevelEXT, 3>, 2> perfNotificationLevels_{};
+    XrPerfSettingsNotificationLevelEXT runtimePerfNotificationLevel_{XR_PERF_SETTINGS_NOTIF_LEVEL_NORMAL_EXT};
+    double perfBoostUntilSeconds_{-1000.0};
+    bool spaceWarpExtensionEnabled_{false};
+    bool spaceWarpReady_{false};
+    std::vector<XrSwapchainBundle> motionVectorSwapchains_;
+    std::vector<XrSwapchainBundle> spaceWarpDepthSwapchains_;
+    GLuint spaceWarpFramebuffer_{0};
+    SpaceWarpMode spaceWarpMode_{SpaceWarpMode::Auto};
+    bool spaceWarpEngaged_{false};
+    bool spaceWarpSubmitting_{false};
+    bool displayRefreshRateExtensionEnabled_{false};
+    // Idle throttle. userPresent_ follows XR_EXT_user_presence (the proximity sensor) when the runtime reports it.
+    bool userPresenceExtensionEnabled_{false};
+    bool userPresent_{true};
+    IdleThrottle idleUnfocusedThrottle_{IdleThrottle::Reduced};
+    IdleThrottle idleAbsentThrottle_{IdleThrottle::Frozen};
+    float idleThrottleRate_{kDefaultIdleThrottleRate};
+    IdleThrottle idleThrottle_{IdleThrottle::Full};
+    double idleThrottleSinceSeconds_{0.0};
+    float idleThrottleGpuMsPerFrame_{0.0f};
+    float idleThrottleCpuMsPerFrame_{0.0f};
+    IdleThrottleSavings idleSavingsSinceLog_;
+    IdleThrottleSavings idleSavingsEpisode_;
+    bool displayRefreshRateReady_{false};
+    PFN_xrEnumerateDisplayRefreshRatesFB xrEnumerateDisplayRefreshRatesFB_{nullptr};
+    PFN_xrGetDisplayRefreshRateFB xrGetDisplayRefreshRateFB_{nullptr};
+    PFN_xrRequestDisplayRefreshRateFB xrRequestDisplayRefreshRateFB_{nullptr};
+    std::vector<float> supportedDisplayRefreshRates_;
+    float activeDisplayRefreshRate_{kReferenceDisplayRefreshRate};
+    float runtimeDefaultDisplayRefreshRate_{kReferenceDisplayRefreshRate};
+    float preferredDisplayRefreshRate_{0.0f};
+    float requestedDisplayRefreshRate_{0.0f};
+    int refreshRateDropSteps_{0};
+    bool foveationExtensionEnabled_{false};
+    bool foveationReady_{false};
+    PFN_xrCreateFoveationProfileFB xrCreateFoveationProfileFB_{nullptr};
+    PFN_xrDestroyFoveationProfileFB xrDestroyFoveationProfileFB_{nullptr};
+    PFN_xrUpdateSwapchainFB xrUpdateSwapchainFB_{nullptr};
+    FoveationLevel foveationLevel_{kDefaultFoveationLevel};
+    bool foveationDynamic_{false};
+    int foveationAutoBoost_{0};
+    FoveationLevel appliedFoveationLevel_{FoveationLevel::Off};
+    bool appliedFoveationDynamic_{false};
     XrActionSet actionSet_{XR_NULL_HANDLE};
     XrAction actionNextPreset_{XR_NULL_HANDLE};
     XrAction actionPrevPreset_{XR_NULL_HANDLE};
@@ -5162,32 +10364,70 @@ private:
     GLint uViewProjectionLoc_{-1};
     GLint uTextureLoc_{-1};
     GLint uProjectionModeLoc_{-1};
+    GLint uCanvasMappingLoc_{-1};
+    GLint uPreviousTextureLoc_{-1};
+    GLint uFrameBlendLoc_{-1};
+    GLint uSnapshotTextureLoc_{-1};
+    GLint uSnapshotFadeLoc_{-1};
     GLuint sgsrProgram_{0};
     GLuint sgsrVao_{0};
     GLuint sgsrVbo_{0};
     GLint sgsrViewportInfoLoc_{-1};
     GLint sgsrSamplerLoc_{-1};
+    GLint sgsrSourceRectLoc_{-1};
+    RenderTargetFormat sourceFormatSetting_{RenderTargetFormat::Auto};
+    RenderTargetFormat outputFormatSetting_{RenderTargetFormat::Auto};
+    RenderTargetFormat appliedSourceFormatSetting_{RenderTargetFormat::Auto};
+    RenderTargetFormat appliedOutputFormatSetting_{RenderTargetFormat::Auto};
+    // What Auto renders as: RGBA8 until the format probe (or render_target_format.txt) picks otherwise.
+    RenderTargetFormat autoRenderTargetFormat_{RenderTargetFormat::Rgba8};
+    RenderTargetFormat appliedAutoRenderTargetFormat_{RenderTargetFormat::Rgba8};
+    bool formatProbePending_{false};
+    size_t formatProbeIndex_{0};
+    size_t formatProbePresetIndex_{0};
+    double formatProbeStartSeconds_{-1.0};
+    std::vector<float> formatProbeCostsMs_;
+    std::string glRendererName_;
+    std::string renderTargetFormatFilePath_;
+    bool colorBufferFloatSupported_{false};
+    RenderTargetFormat projectMSourceFormat_{RenderTargetFormat::Rgba8};
+    RenderTargetFormat projectMOutputFormat_{RenderTargetFormat::Rgba8};
+    PFNGLGETQUERYOBJECTUI64VEXTPROC glGetQueryObjectui64vEXT_{nullptr};
+    GpuPassTimer projectMPassTimer_;
+    GpuPassTimer upscalePassTimer_;
+    GpuPassTimer hudPassTimer_;
+    GpuPassTimer eyePassTimer_;
+    GpuPassTimer handsPassTimer_;
+    double projectMGpuStatsPublishSeconds_{-1000.0};
+    PassSampleWindow projectMCpuWindow_;
+    double projectMCpuStatsPublishSeconds_{-1000.0};
+    double eyeGpuStatsPublishSeconds_{-1000.0};
+    mutable std::mutex gpuPassStatsMutex_;
+    std::array<GpuPassStats, kGpuPassCount> gpuPassStats_{};
+    ProjectMCpuStats projectMCpuStats_;
+    std::string gpuStatsFilePath_;
     GLuint handProgram_{0};
     GLuint handVao_{0};
     GLuint handVbo_{0};
     GLint handViewProjectionLoc_{-1};
-    GLint handColorLoc_{-1};
-    GLint handPointSizeLoc_{-1};
+    std::array<HandOverlayVertex, kHandOverlayLineCapacity + kHandOverlayPointCapacity> handOverlayVertices_{};
+    GLsizei handOverlayLineVertexCount_{0};
+    GLsizei handOverlayPointVertexCount_{0};
     GLuint hudProgram_{0};
     GLuint hudVao_{0};
     GLuint hudVbo_{0};
     GLint hudMvpLoc_{-1};
-    GLint hudFlashALoc_{-1};
-    GLint hudFlashBLoc_{-1};
-    GLint hudFlashXLoc_{-1};
-    GLint hudFlashYLoc_{-1};
-    GLint hudFlashRtLoc_{-1};
-    GLint hudFlashLtLoc_{-1};
-    GLint hudFlashMenuLoc_{-1};
+    GLint hudButtonFlashLoc_{-1};
+    GLint hudFlashActiveLoc_{-1};
     GLint hudPointerLeftLoc_{-1};
     GLint hudPointerRightLoc_{-1};
     GLint hudTextSamplerLoc_{-1};
     GLuint hudTextTexture_{0};
+    GLint hudChromeSamplerLoc_{-1};
+    GLuint hudChromeProgram_{0};
+    GLuint hudChromeFramebuffer_{0};
+    GLuint hudChromeTexture_{0};
+    bool hudChromeDirty_{true};
     std::vector<uint8_t> hudTextPixels_;
 
     GLuint sphereVao_{0};
@@ -5196,14 +10436,89 @@ private:
     GLsizei sphereIndexCount_{0};
 
     projectm_handle projectM_{nullptr};
-    GLuint projectMTexture_{0};
+    // Owned by the projectM render thread (or the main thread when async rendering is off).
     GLuint projectMLowResTexture_{0};
     GLuint projectMFbo_{0};
-    GLuint projectMUpscaleFbo_{0};
+    std::array<ProjectMOutputSlot, kProjectMOutputSlotCount> projectMOutputSlots_{};
+    uint64_t projectMNextFrameId_{0};
+    uint64_t projectMRenderPresetGeneration_{0};
+    double lastProjectMFrameSeconds_{0.0};
+    std::vector<float> projectMPcmScratch_;
+    // Slot indices shared between threads, guarded by projectMOutputMutex_.
+    std::mutex projectMOutputMutex_;
+    int projectMDisplaySlot_{kNoProjectMOutputSlot};
+    int projectMPreviousSlot_{kNoProjectMOutputSlot};
+    int projectMPublishedSlot_{kNoProjectMOutputSlot};
+    // Main-thread views of the display and previous slots sampled by the eye pass.
+    GLuint projectMTexture_{0};
+    GLuint projectMPreviousTexture_{0};
+    int projectMCadenceLevel_{0};
+    int projectMCadenceBaseLevel_{0};
+    float projectMCadenceAccumulator_{0.0f};
+    int displayFramesSinceProjectMFrame_{0};
+    float projectMFrameBlend_{1.0f};
+    // Snapshot crossfade: a main-context copy of the outgoing preset's last frame, faded out over the transition.
+    GLuint projectMSnapshotTexture_{0};
+    GLuint projectMSnapshotFramebuffer_{0};
+    GLuint projectMSnapshotReadFramebuffer_{0};
+    int projectMSnapshotWidth_{0};
+    int projectMSnapshotHeight_{0};
+    RenderTargetFormat projectMSnapshotFormat_{RenderTargetFormat::Rgba8};
+    double projectMSnapshotRequestSeconds_{0.0};
+    double projectMSnapshotStartSeconds_{0.0};
+    // Preset generations: bumped per load on the main thread, and the one the displayed frame was rendered after.
+    uint64_t projectMRequestedPresetGeneration_{0};
+    uint64_t projectMDisplayPresetGeneration_{0};
+    uint64_t projectMSnapshotPresetGeneration_{0};
+    float projectMSnapshotFade_{1.0f};
+
+    bool projectMAsyncRender_{false};
+    EGLContext projectMEglContext_{EGL_NO_CONTEXT};
+    EGLSurface projectMEglSurface_{EGL_NO_SURFACE};
+    std::thread projectMThread_;
+    std::mutex projectMThreadMutex_;
+    std::condition_variable projectMThreadCondition_;
+    std::deque<std::function<void()>> projectMJobs_;
+    std::vector<float> projectMPendingPcm_;
+    bool projectMFrameRequested_{false};
+    double projectMRequestedFrameSeconds_{0.0};
+    bool projectMThreadStop_{false};
+    std::atomic<uint64_t> projectMFramesProduced_{0};
+    uint64_t projectMFramesConsumed_{0};
+    uint64_t projectMFrameRequestsCoalesced_{0};
+    std::atomic<uint64_t> projectMFramesDropped_{0};
+    // Runaway-frame watchdog: the fence and its start time are render-thread only; the streak of consecutive
+    // overruns is read by the main thread, which owns the deadline setting.
+    GLsync projectMWatchdogFence_{nullptr};
+    std::chrono::steady_clock::time_point projectMWatchdogStart_{};
+    bool projectMWatchdogOverrun_{false};
+    std::atomic<int> projectMWatchdogStreak_{0};
+    std::atomic<uint64_t> projectMWatchdogOverruns_{0};
+    std::atomic<float> projectMWatchdogDeadlineMs_{kDefaultPerfWatchdogDeadlineMs};
+    bool perfWatchdogEnabled_{kDefaultPerfWatchdogEnabled};
+    int perfWatchdogOverruns_{static_cast<int>(kDefaultPerfWatchdogOverruns)};
+    double watchdogResumeSeconds_{-1.0};
+    double projectMStalenessSmoothedSeconds_{0.0};
+    double projectMStalenessMaxSeconds_{0.0};
     uint32_t projectMOutputWidth_{kProjectMOutputWidthNative};
     uint32_t projectMOutputHeight_{kProjectMOutputHeightNative};
     int projectMRenderWidth_{static_cast<int>(kProjectMOutputWidthNative)};
     int projectMRenderHeight_{static_cast<int>(kProjectMOutputHeightNative)};
+    // Allocated SGSR source size and the region projectM currently renders into (projectM context only).
+    int projectMLowResWidth_{0};
+    int projectMLowResHeight_{0};
+    int projectMViewportWidth_{0};
+    int projectMViewportHeight_{0};
+    // Adaptive viewport size waiting for the resize gate, and the cost probe of the last resize (projectM context).
+    int projectMPendingViewportWidth_{0};
+    int projectMPendingViewportHeight_{0};
+    double projectMPendingViewportSinceSeconds_{0.0};
+    double projectMLastResizeSeconds_{-1000.0};
+    bool projectMResizeProbePending_{false};
+    int projectMResizeFromWidth_{0};
+    int projectMResizeFromHeight_{0};
+    float projectMResizeSetMs_{0.0f};
+    float projectMResizeCpuP50Ms_{0.0f};
     float projectMRenderScale_{kDefaultProjectMRenderScale};
     float projectMAdaptiveRenderScale_{kDefaultProjectMRenderScale};
     bool projectMUseUpscaler_{false};
@@ -5219,21 +10534,60 @@ private:
     bool currentMediaPlaying_{false};
     std::string currentMediaLabel_{"none"};
     std::string currentPresetLabel_{"FALLBACK"};
-    bool hudTextDirty_{true};
-    std::string hudRenderedAudioLabel_;
-    std::string hudRenderedProjectionLabel_;
-    std::string hudRenderedPlaybackLabel_;
-    std::string hudRenderedPresetLabel_;
-    std::string hudRenderedFavoriteLabel_;
-    std::string hudRenderedPresetLockLabel_;
-    std::string hudRenderedBottomLeftLabel_;
-    std::string hudRenderedBottomCenterLabel_;
-    std::string hudRenderedBottomRightLabel_;
+    // HUD text thread state. Labels, pixels, dirty rects and the worker upload belong to the thread while it
+    // runs; the job, unpack buffer states and raster stats are guarded by hudTextMutex_.
+    std::thread hudTextThread_;
+    std::mutex hudTextMutex_;
+    std::condition_variable hudTextCondition_;
+    bool hudTextThreadStop_{false};
+    bool hudTextJobPending_{false};
+    std::array<std::string, kHudTextLabelCount> hudTextJobLabels_{};
+    std::array<HudTextLabelState, kHudTextLabelCount> hudTextLabels_{};
+    std::vector<HudPixelRect> hudTextDirtyRects_;
+    HudTextUpload hudTextWorkerUpload_;
+    uint32_t hudTextUpdatesSinceLog_{0};
+    double hudTextRasterMaxMicros_{0.0};
+    std::array<std::string, kHudTextLabelCount> hudTextSubmittedLabels_{};
+    bool hudTextLabelsSubmitted_{false};
+    // Frame capture. Slots, the framebuffer and the cost stats belong to the main thread; the job queue,
+    // written-slot list and write stats are guarded by captureMutex_.
+    CaptureMode captureMode_{CaptureMode::Off};
+    double captureIntervalSeconds_{kDefaultCaptureIntervalSeconds};
+    int captureMaxFrames_{static_cast<int>(kDefaultCaptureMaxFrames)};
+    std::string captureDirectory_;
+    std::string captureSessionPrefix_;
+    std::array<CaptureSlot, kCaptureRingSize> captureSlots_{};
+    GLuint captureFramebuffer_{0};
+    uint64_t captureFrameIndex_{0};
+    uint32_t captureSequence_{0};
+    double nextCaptureSeconds_{0.0};
+    bool captureFrameDue_{false};
+    bool captureFrameActive_{false};
+    double captureFrameMicros_{0.0};
+    double captureCostMicrosTotal_{0.0};
+    double captureCostMaxMicros_{0.0};
+    uint32_t captureCostFrames_{0};
+    uint32_t captureReadbacksSinceLog_{0};
+    uint32_t captureSkippedSinceLog_{0};
+    std::thread captureThread_;
+    std::mutex captureMutex_;
+    std::condition_variable captureCondition_;
+    bool captureThreadStop_{false};
+    std::deque<CaptureJob> captureJobs_;
+    std::vector<size_t> captureWrittenSlots_;
+    uint32_t captureFilesWrittenSinceLog_{0};
+    double captureWriteMaxMillis_{0.0};
+    // File write thread. The job queue is guarded by fileWriteMutex_.
+    std::thread fileWriteThread_;
+    std::mutex fileWriteMutex_;
+    std::condition_variable fileWriteCondition_;
+    bool fileWriteThreadStop_{false};
+    std::deque<FileWriteJob> fileWriteJobs_;
+    std::array<HudTextPbo, kHudTextPboCount> hudTextPbos_{};
+    size_t hudTextUploadBytesSinceLog_{0};
+    double hudTextUploadMaxMicros_{0.0};
     std::string hudPresetSourceLabel_;
-    std::string hudRenderedRenderStatsLabel_;
-    std::string hudRenderedTrackLabel_;
     std::string hudInputFeedbackLabel_{"READY"};
-    std::string hudRenderedInputFeedbackLabel_;
     bool hudEnabled_{true};
     float hudDistance_{kHudDistance};
     float hudVerticalOffset_{kHudVerticalOffset};
@@ -5241,6 +10595,9 @@ private:
     float hudHeight_{kHudHeight};
 
     ProjectionMode projectionMode_{ProjectionMode::FullSphere};
+    CanvasMapping canvasMappingSetting_{CanvasMapping::Equirect};
+    // Mapping the current output targets were sized for; the eye pass samples with this one.
+    CanvasMapping projectMCanvasMapping_{CanvasMapping::Equirect};
     float hudFlashA_{0.0f};
     float hudFlashB_{0.0f};
     float hudFlashX_{0.0f};
@@ -5275,8 +10632,26 @@ private:
     float audioBeatPhase_{0.0f};
     int meshWidth_{kDefaultMeshWidth};
     int meshHeight_{kDefaultMeshHeight};
+    // Largest mesh the per-preset mesh governor may pick: the quality rung's, or perf.mesh without the governor.
+    int meshCapWidth_{kDefaultMeshWidth};
+    int meshCapHeight_{kDefaultMeshHeight};
+    bool perfAutoMeshEnabled_{kDefaultPerfAutoMeshEnabled};
+    float perfMeshCpuBudgetFraction_{kDefaultPerfMeshCpuBudgetFraction};
+    double lastMeshChangeSeconds_{-1000.0};
+    double meshUpgradeSinceSeconds_{-1.0};
+    // Render thread: the mesh size projectM is currently using.
+    int projectMMeshWidth_{kDefaultMeshWidth};
+    int projectMMeshHeight_{kDefaultMeshHeight};
     bool perfAutoSkipEnabled_{true};
     bool perfAutoScaleEnabled_{kDefaultPerfAutoScaleEnabled};
+    bool perfAutoFoveationEnabled_{kDefaultPerfAutoFoveationEnabled};
+    bool perfAutoEyeScaleEnabled_{kDefaultPerfAutoEyeScaleEnabled};
+    bool perfAutoRefreshRateEnabled_{kDefaultPerfAutoRefreshRateEnabled};
+    bool perfAutoCadenceEnabled_{kDefaultPerfAutoCadenceEnabled};
+    float perfEyeBufferMinScale_{kDefaultEyeBufferMinScale};
+    float eyeBufferMaxScale_{kDefaultEyeBufferMaxScale};
+    float eyeBufferScale_{1.0f};
+    float eyeBufferAdaptiveScale_{1.0f};
     bool skipMarkedPresets_{true};
     float perfAutoSkipMinFps_{kDefaultPerfAutoSkipMinFps};
     double perfAutoSkipHoldSeconds_{kDefaultPerfAutoSkipHoldSeconds};
@@ -5292,6 +10667,23 @@ private:
     float perfAutoScaleUpFps_{kDefaultPerfAutoScaleUpFps};
     double perfAutoScaleHoldSeconds_{kDefaultPerfAutoScaleHoldSeconds};
     double perfAutoScaleCooldownSeconds_{kDefaultPerfAutoScaleCooldownSeconds};
+    bool perfGpuScaleEnabled_{kDefaultPerfGpuScaleEnabled};
+    float perfGpuBudgetFraction_{kDefaultPerfGpuBudgetFraction};
+    bool qualityGovernorEnabled_{kDefaultQualityGovernorEnabled};
+    std::string qualityLadderText_;
+    std::string qualityLadderFilePath_;
+    std::string qualityLadderFileText_;
+    std::vector<QualityRung> qualityLadder_;
+    size_t qualityRung_{0};
+    double qualityRungChangedSeconds_{-1000.0};
+    double qualityUpgradeSinceSeconds_{-1.0};
+    double qualityLowFpsSinceSeconds_{-1.0};
+    size_t qualityFpsFloorRung_{0};
+    double qualityFpsFloorSetSeconds_{-1000.0};
+    bool qualityLearnPending_{false};
+    size_t qualityLearnFromRung_{0};
+    double qualityLearnProjectMMs_{0.0};
+    double qualityLearnEyeMs_{0.0};
     double smoothedFrameSeconds_{1.0 / 72.0};
     double lowFpsSinceSeconds_{-1.0};
     double lastAutoSkipSeconds_{-1000.0};
@@ -5302,9 +10694,20 @@ private:
     double lastRuntimePropertyPollSeconds_{-1000.0};
     bool clearMarkedLatch_{false};
     std::vector<std::string> slowPresets_;
+    // Preset keys the watchdog cut away from; never selected again this session.
+    std::vector<std::string> quarantinedPresets_;
     std::unordered_map<std::string, int> slowPresetFailureCounts_;
     std::unordered_map<std::string, double> slowPresetRetryEligibleAfterSeconds_;
     std::unordered_map<std::string, double> slowPresetRetryWarmupUntilSeconds_;
+    std::unordered_map<std::string, int> presetCadenceLevels_;
+    std::unordered_map<std::string, std::pair<int, int>> presetMeshSizes_;
+    std::string presetMeshFilePath_;
+    // projectM pass p95 per megapixel of render target, measured after each preset's blend.
+    std::unordered_map<std::string, float> presetGpuCosts_;
+    bool presetGpuCostsDirty_{false};
+    std::string presetGpuCostFilePath_;
+    PresetTransitionMode presetTransitionMode_{PresetTransitionMode::Auto};
+    double presetBlendSeconds_{kPresetBlendSeconds};
     std::string slowPresetFilePath_;
     std::vector<std::string> favoritePresets_;
     std::string favoritePresetFilePath_;
@@ -5313,6 +10716,13 @@ private:
     bool hudUtilityPanelOpen_{false};
 
     std::chrono::steady_clock::time_point startTime_{};
+    double initializedSeconds_{0.0};
+    bool firstFrameLogged_{false};
+    // Programs are built on both the main and the projectM context, hence the atomics.
+    std::string programCacheDirectory_;
+    std::atomic<uint32_t> programCacheHits_{0};
+    std::atomic<uint32_t> programCacheMisses_{0};
+    std::atomic<uint64_t> programBuildMicros_{0};
     double lastFrameSeconds_{0.0};
     double lastPresetSwitchSeconds_{0.0};
     double lastPresetScanSeconds_{0.0};